@@ -3,6 +3,18 @@
 #include "Grid_Builder.h"
 #include "Reconstruction_Method.h"
 
+#include <execution>
+#include <numeric>
+#include <ranges>
+
+
+struct Boundary_Group		// boundaries of same type, which are contiguous after sorting
+{
+    ElementType type;
+    size_t start_index;
+    size_t end_index;
+};
+
 
 //FVM̸  ϴ variable
 template <typename Governing_Equation>
@@ -10,18 +22,27 @@ class Boundaries_FVM_Base
 {
 private:
     static constexpr size_t space_dimension_ = Governing_Equation::space_dimension();
+    static constexpr size_t num_equation_ = Governing_Equation::num_equation();
 
     using Space_Vector_ = Governing_Equation::Space_Vector_;
+    using Boundary_Flux_ = EuclideanVector<num_equation_>;
+    using Solver_Workspace_ = Solver_Workspace<num_equation_, space_dimension_>;
 
 protected:
     size_t num_boundaries_ = 0;
     std::vector<Space_Vector_> normals_;
     std::vector<size_t> oc_indexes_;
     std::vector<double> areas_;    
-    std::vector<std::unique_ptr<Boundary_Flux_Function<Governing_Equation>>> boundary_flux_functions_;
+    std::vector<Boundary_Group> boundary_groups_;
+    std::vector<std::vector<size_t>> same_color_boundary_indexes_set_;  // boundaries in same color do not share owner cell
+    Cell_To_Face_CSR cell_to_boundary_csr_;
 
 public:
     Boundaries_FVM_Base(Grid<space_dimension_>&& grid);
+
+protected:
+    template <typename Boundary_Flux_Kernel>
+    void calculate_grouped_RHS(Solver_Workspace_& workspace, const Boundary_Flux_Kernel& calculate_boundary_flux) const;
 };
 
 
@@ -35,11 +56,12 @@ private:
 
     using Solution_     = typename Governing_Equation::Solution_;
     using Boundary_Flux_     = EuclideanVector<num_equation_>;
+    using Solver_Workspace_ = Solver_Workspace<num_equation_, space_dimension_>;
 
 public:
     Boundaries_FVM_Constant(Grid<space_dimension_>&& grid) : Boundaries_FVM_Base<Governing_Equation>(std::move(grid)) {};
 
-    void calculate_RHS(std::vector<Boundary_Flux_>& RHS, const std::vector<Solution_>& solutions) const;
+    void calculate_RHS(Solver_Workspace_& workspace, const std::vector<Solution_>& solutions) const;
 };
 
 
@@ -54,6 +76,7 @@ private:
     using Space_Vector_ = EuclideanVector <space_dimension_>;
     using Solution_     = typename Governing_Equation::Solution_;
     using Boundary_Flux_     = EuclideanVector<num_equation_>;
+    using Solver_Workspace_ = Solver_Workspace<num_equation_, space_dimension_>;
 
 private:
     std::vector<Space_Vector_> oc_to_boundary_vectors_;
@@ -61,7 +84,7 @@ private:
 public:
     Boundaries_FVM_Linear(Grid<space_dimension_>&& grid);
 
-    void calculate_RHS(std::vector<Boundary_Flux_>& RHS, const Linear_Reconstructed_Solution<num_equation_, space_dimension_>& linear_reconstructed_solution) const;
+    void calculate_RHS(Solver_Workspace_& workspace, const Linear_Reconstructed_Solution<num_equation_, space_dimension_>& linear_reconstructed_solution) const;
 };
 
 
@@ -70,35 +93,96 @@ template <typename Governing_Equation>
 Boundaries_FVM_Base<Governing_Equation>::Boundaries_FVM_Base(Grid<space_dimension_>&& grid) {
     SET_TIME_POINT;
 
-    this->num_boundaries_ = grid.elements.boundary_elements.size();
+    auto& boundary_elements = grid.elements.boundary_elements;
+    this->num_boundaries_ = boundary_elements.size();
+
+    //sort boundaries by type
+    std::vector<size_t> sorted_indexes(this->num_boundaries_);
+    std::iota(sorted_indexes.begin(), sorted_indexes.end(), 0);
+    std::stable_sort(sorted_indexes.begin(), sorted_indexes.end(), [&](const size_t i, const size_t j) {
+        return boundary_elements[i].type() < boundary_elements[j].type();
+        });
+
+    const auto sort_by_type = [&](auto& values) {
+        std::remove_reference_t<decltype(values)> sorted_values;
+        sorted_values.reserve(this->num_boundaries_);
+        for (const auto index : sorted_indexes)
+            sorted_values.push_back(std::move(values[index]));
+        values = std::move(sorted_values);
+    };
+    sort_by_type(boundary_elements);
+    sort_by_type(grid.connectivity.boundary_normals);
+    sort_by_type(grid.connectivity.boundary_oc_indexes);
+    sort_by_type(grid.geometry.boundary_centers);
+    sort_by_type(grid.geometry.boundary_areas);
+
+    this->areas_ = grid.geometry.boundary_areas;
+
+    for (size_t i = 0; i < this->num_boundaries_; ++i) {
+        const auto& element = boundary_elements[i];
+        const auto type = element.type();
+        dynamic_require(ms::is_supported_boundary_type<Governing_Equation>(type), "wrong element type");
 
-    this->areas_.reserve(this->num_boundaries_);
-    this->boundary_flux_functions_.reserve(this->num_boundaries_);
-    for (const auto& element : grid.elements.boundary_elements) {
-        this->areas_.push_back(element.geometry_.volume());
-        this->boundary_flux_functions_.push_back(Boundary_Flux_Function_Factory<Governing_Equation>::make(element.type()));
+        if (this->boundary_groups_.empty() || this->boundary_groups_.back().type != type)
+            this->boundary_groups_.push_back({ type, i, i });
+        this->boundary_groups_.back().end_index = i + 1;
     }
 
     this->normals_ = std::move(grid.connectivity.boundary_normals);
     this->oc_indexes_ = std::move(grid.connectivity.boundary_oc_indexes);
 
+    const auto num_cell = grid.elements.cell_elements.size();
+    this->same_color_boundary_indexes_set_ = ms::color_faces(num_cell, this->oc_indexes_);
+    this->cell_to_boundary_csr_ = ms::make_cell_to_face_csr(num_cell, this->oc_indexes_, this->areas_);
+
     Log::content_ << std::left << std::setw(50) << "@ Boundaries FVM base precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 }
 
 template <typename Governing_Equation>
-void Boundaries_FVM_Constant<Governing_Equation>::calculate_RHS(std::vector<Boundary_Flux_>& RHS, const std::vector<Solution_>& solutions) const {
-    for (size_t i = 0; i < this->num_boundaries_; ++i) {        
-        const auto& boundary_flux_function = this->boundary_flux_functions_.at(i);
-        
+template <typename Boundary_Flux_Kernel>
+void Boundaries_FVM_Base<Governing_Equation>::calculate_grouped_RHS(Solver_Workspace_& workspace, const Boundary_Flux_Kernel& calculate_boundary_flux) const {
+    auto& RHS = workspace.RHS;
+    auto& boundary_fluxes = workspace.face_fluxes;
+
+    //statically dispatched boundary flux function for each group
+    for (const auto& boundary_group : this->boundary_groups_) {
+        ms::visit_boundary_flux_function<Governing_Equation>(boundary_group.type, [&](const auto boundary_flux_function) {
+            const auto group_indexes = std::views::iota(boundary_group.start_index, boundary_group.end_index);
+
+            std::for_each(std::execution::par, group_indexes.begin(), group_indexes.end(), [&](const size_t i) {
+                boundary_fluxes[i] = calculate_boundary_flux(boundary_flux_function, i);
+            });
+        });
+    }
+
+#ifdef RHS_GATHER_MODE
+    this->cell_to_boundary_csr_.gather(RHS, boundary_fluxes);
+#else
+    for (const auto& same_color_boundary_indexes : this->same_color_boundary_indexes_set_) {
+        std::for_each(std::execution::par, same_color_boundary_indexes.begin(), same_color_boundary_indexes.end(), [&](const size_t i) {
+            const auto oc_index = this->oc_indexes_[i];
+            const auto delta_RHS = this->areas_[i] * boundary_fluxes[i];
+
+            RHS[oc_index] -= delta_RHS;
+        });
+    }
+#endif
+}
+
+template <typename Governing_Equation>
+void Boundaries_FVM_Constant<Governing_Equation>::calculate_RHS(Solver_Workspace_& workspace, const std::vector<Solution_>& solutions) const {
+    const auto calculate_boundary_flux = [&](const auto boundary_flux_function, const size_t i) {
         const auto oc_index = this->oc_indexes_[i];
         const auto& normal = this->normals_[i];
 
-        const auto boundary_flux = boundary_flux_function->calculate(solutions[oc_index], normal);
-        const auto delta_RHS = this->areas_[i] * boundary_flux;
+        if constexpr (std::is_same_v<Governing_Equation, Euler_2D>)
+            return boundary_flux_function.calculate(solutions[oc_index], workspace.primitive_variables[oc_index], normal);
+        else
+            return boundary_flux_function.calculate(solutions[oc_index], normal);
+    };
 
-        RHS[oc_index] -= delta_RHS;
-    }
+    this->calculate_grouped_RHS(workspace, calculate_boundary_flux);
 }
 
 template <typename Governing_Equation>
@@ -107,16 +191,12 @@ Boundaries_FVM_Linear<Governing_Equation>::Boundaries_FVM_Linear(Grid<space_dime
 
     this->oc_to_boundary_vectors_.reserve(this->num_boundaries_);
 
-    const auto& cell_elements = grid.elements.cell_elements;
-    const auto& boundary_elements = grid.elements.boundary_elements;
+    const auto& cell_centers = grid.geometry.cell_centers;
     for (size_t i = 0; i < this->num_boundaries_; ++i) {
         const auto oc_index = this->oc_indexes_[i];
 
-        const auto& oc_geometry = cell_elements[oc_index].geometry_;
-        const auto& boundary_geometry = boundary_elements[i].geometry_;
-
-        const auto oc_center = oc_geometry.center_node();
-        const auto boundary_center = boundary_geometry.center_node();
+        const auto& oc_center = cell_centers[oc_index];
+        const auto& boundary_center = grid.geometry.boundary_centers[i];
 
         const auto oc_to_face_vector = boundary_center - oc_center;
 
@@ -128,15 +208,14 @@ Boundaries_FVM_Linear<Governing_Equation>::Boundaries_FVM_Linear(Grid<space_dime
 };
 
 template <typename Governing_Equation>
-void Boundaries_FVM_Linear<Governing_Equation>::calculate_RHS(std::vector<Boundary_Flux_>& RHS, const Linear_Reconstructed_Solution<num_equation_, space_dimension_>& linear_reconstructed_solution) const {
+void Boundaries_FVM_Linear<Governing_Equation>::calculate_RHS(Solver_Workspace_& workspace, const Linear_Reconstructed_Solution<num_equation_, space_dimension_>& linear_reconstructed_solution) const {
     const auto& solutions = linear_reconstructed_solution.solutions;
     const auto& solution_gradients = linear_reconstructed_solution.solution_gradients;
 
-    for (size_t i = 0; i < this->num_boundaries_; ++i) {
-        const auto& boundary_flux_function = this->boundary_flux_functions_.at(i);
-        const auto& normal = this->normals_.at(i);
+    const auto calculate_boundary_flux = [&](const auto boundary_flux_function, const size_t i) {
+        const auto& normal = this->normals_[i];
 
-        const auto oc_index = this->oc_indexes_.at(i);
+        const auto oc_index = this->oc_indexes_[i];
 
         const auto& oc_solution = solutions[oc_index];
         const auto& oc_solution_gradient = solution_gradients[oc_index];
@@ -144,10 +223,8 @@ void Boundaries_FVM_Linear<Governing_Equation>::calculate_RHS(std::vector<Bounda
 
         const auto oc_side_solution = oc_solution + oc_solution_gradient * oc_to_face_vector;
 
-        const auto boundary_flux = boundary_flux_function->calculate(oc_side_solution, normal);
-
-        const auto delta_RHS = this->areas_[i] * boundary_flux;
+        return boundary_flux_function.calculate(oc_side_solution, normal);
+    };
 
-        RHS[oc_index] -= delta_RHS;
-    }
+    this->calculate_grouped_RHS(workspace, calculate_boundary_flux);
 }
\ No newline at end of file
@@ -2,27 +2,14 @@
 #include "Governing_Equation.h"
 #include "Element.h"
 
-template <typename Governing_Equation>
-class Boundary_Flux_Function
-{
-protected:
-	static_require(ms::is_governing_equation<Governing_Equation>, "It should be Governing Equation");
-
-	static constexpr size_t num_equation_ = Governing_Equation::num_equation();
-
-	using Space_Vector_		= typename Governing_Equation::Space_Vector_;
-	using Solution_			= typename Governing_Equation::Solution_;
-	using Boundary_Flux_	= EuclideanVector<num_equation_>;
-
-public:
-	virtual Boundary_Flux_ calculate(const Solution_& oc_cvariable, const Space_Vector_& normal) abstract;
-};
+class BFF {};	// Boundary Flux Function
 
 
+// every boundary flux function provides static calculate, so boundaries of same type are evaluated without virtual call
 template <typename Governing_Equation>
-class Supersonic_Outlet_2D : public Boundary_Flux_Function<Governing_Equation>
+class Supersonic_Outlet_2D : public BFF
 {
-protected:
+private:
 	static_require(ms::is_governing_equation<Governing_Equation>, "It should be Governing Equation");
 
 	static constexpr size_t num_equation_ = Governing_Equation::num_equation();
@@ -32,56 +19,85 @@ protected:
 	using Boundary_Flux_ = EuclideanVector<num_equation_>;
 
 public:
-	Boundary_Flux_ calculate(const Solution_& solution, const Space_Vector_& normal) override;
+	static Boundary_Flux_ calculate(const Solution_& solution, const Space_Vector_& normal);
+	static Boundary_Flux_ calculate(const Solution_& oc_cvariable, const Solution_& oc_pvariable, const Space_Vector_& normal);	// reuse primitive variable when governing equation has it
 };
 
 
-class Slip_Wall_2D : public Boundary_Flux_Function<Euler_2D>
+class Slip_Wall_2D : public BFF
 {
-	Boundary_Flux_ calculate(const Solution_& oc_cvariable, const Space_Vector_& normal) override;
+private:
+	using Space_Vector_ = typename Euler_2D::Space_Vector_;
+	using Solution_ = typename Euler_2D::Solution_;
+	using Boundary_Flux_ = EuclideanVector<Euler_2D::num_equation()>;
+
+public:
+	static Boundary_Flux_ calculate(const Solution_& oc_cvariable, const Space_Vector_& normal);
+	static Boundary_Flux_ calculate(const Solution_& oc_cvariable, const Solution_& oc_pvariable, const Space_Vector_& normal);
 };
 
 
+namespace ms {
+	template <typename T>
+	inline constexpr bool is_boundary_flux_function = std::is_base_of_v<BFF, T>;
 
-template <typename Governing_Equation>
-class Boundary_Flux_Function_Factory
-{
-public:
-	static std::unique_ptr<Boundary_Flux_Function<Governing_Equation>> make(const ElementType boundary_type);
-};
+	// call kernel with boundary flux function object which matches boundary type
+	template <typename Governing_Equation, typename Kernel>
+	void visit_boundary_flux_function(const ElementType boundary_type, Kernel&& kernel);
 
+	template <typename Governing_Equation>
+	bool is_supported_boundary_type(const ElementType boundary_type);
+}
 
 
 //template definition part
-template <typename Governing_Equation> 
+template <typename Governing_Equation>
 Supersonic_Outlet_2D<Governing_Equation>::Boundary_Flux_ Supersonic_Outlet_2D<Governing_Equation>::calculate(const Solution_& solution, const Space_Vector_& normal) {
 		const auto oc_physical_flux = Governing_Equation::physical_flux(solution);
 		return oc_physical_flux * normal;
 }
 
-
 template <typename Governing_Equation>
-std::unique_ptr<Boundary_Flux_Function<Governing_Equation>> Boundary_Flux_Function_Factory<Governing_Equation>::make(const ElementType boundary_type) {
-	if constexpr (ms::is_SCL_2D<Governing_Equation>) {
+Supersonic_Outlet_2D<Governing_Equation>::Boundary_Flux_ Supersonic_Outlet_2D<Governing_Equation>::calculate(const Solution_& oc_cvariable, const Solution_& oc_pvariable, const Space_Vector_& normal) {
+	if constexpr (std::is_same_v<Governing_Equation, Euler_2D>) {
+		const auto oc_physical_flux = Euler_2D::physical_flux(oc_cvariable, oc_pvariable);
+		return oc_physical_flux * normal;
+	}
+	else
+		return calculate(oc_cvariable, normal);
+}
+
+
+namespace ms {
+	template <typename Governing_Equation, typename Kernel>
+	void visit_boundary_flux_function(const ElementType boundary_type, Kernel&& kernel) {
 		switch (boundary_type)
 		{
 		case ElementType::supersonic_outlet_2D:
-			return std::make_unique<Supersonic_Outlet_2D<Governing_Equation>>();
+			kernel(Supersonic_Outlet_2D<Governing_Equation>());
+			break;
+		case ElementType::slip_wall_2D:
+			if constexpr (!ms::is_SCL_2D<Governing_Equation>) {
+				kernel(Slip_Wall_2D());
+				break;
+			}
+			[[fallthrough]];
 		default:
 			throw std::runtime_error("wrong element type");
 			break;
 		}
 	}
-	else {
+
+	template <typename Governing_Equation>
+	bool is_supported_boundary_type(const ElementType boundary_type) {
 		switch (boundary_type)
 		{
 		case ElementType::supersonic_outlet_2D:
-			return std::make_unique<Supersonic_Outlet_2D<Governing_Equation>>();
+			return true;
 		case ElementType::slip_wall_2D:
-			return std::make_unique<Slip_Wall_2D>();
+			return !ms::is_SCL_2D<Governing_Equation>;
 		default:
-			throw std::runtime_error("wrong element type");
-			break;
+			return false;
 		}
 	}
 }
\ No newline at end of file
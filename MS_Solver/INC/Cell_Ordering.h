@@ -0,0 +1,136 @@
+#pragma once
+#include "EuclideanVector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+
+class CO {};	// Cell Ordering
+
+
+// every cell ordering returns new to old cell index table := cell_order[new cell index] = old cell index
+class Original_Order : public CO
+{
+public:
+	template <size_t space_dimension>
+	static std::vector<size_t> calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs);
+
+	static std::string name(void) { return "Original_Order"; };
+};
+
+
+// breadth first numbering from a pseudo peripheral cell, which minimizes bandwidth of face connectivity
+class Reverse_Cuthill_McKee : public CO
+{
+public:
+	template <size_t space_dimension>
+	static std::vector<size_t> calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs);
+
+	static std::string name(void) { return "Reverse_Cuthill_McKee"; };
+
+private:
+	static std::vector<size_t> calculate_cell_order(const size_t num_cell, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs);
+};
+
+
+// numbering along hilbert curve through cell centers, which keeps cells close in space close in memory
+class Hilbert_Curve : public CO
+{
+public:
+	template <size_t space_dimension>
+	static std::vector<size_t> calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs);
+
+	static std::string name(void) { return "Hilbert_Curve"; };
+
+private:
+	static constexpr size_t num_level_ = 16;
+
+	static std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y);
+};
+
+
+namespace ms {
+	template <typename T>
+	inline constexpr bool is_cell_ordering = std::is_base_of_v<CO, T>;
+
+	size_t calculate_bandwidth(const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs);	// max |oc index - nc index|
+
+	template <typename T>
+	void permute(std::vector<T>& values, const std::vector<size_t>& new_to_old_indexes);
+}
+
+
+//template definition part
+template <size_t space_dimension>
+std::vector<size_t> Original_Order::calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs) {
+	std::vector<size_t> cell_order(cell_centers.size());
+	std::iota(cell_order.begin(), cell_order.end(), 0);
+	return cell_order;
+}
+
+template <size_t space_dimension>
+std::vector<size_t> Reverse_Cuthill_McKee::calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs) {
+	return calculate_cell_order(cell_centers.size(), adjacent_cell_index_pairs);
+}
+
+template <size_t space_dimension>
+std::vector<size_t> Hilbert_Curve::calculate_cell_order(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs) {
+	static_require(space_dimension == 2, "Hilbert curve ordering is implemented for 2D grid");
+
+	const auto num_cell = cell_centers.size();
+	if (num_cell == 0)
+		return {};
+
+	std::array<double, space_dimension> min_coordinate, max_coordinate;
+	for (size_t i = 0; i < space_dimension; ++i)
+		min_coordinate[i] = max_coordinate[i] = cell_centers.front()[i];
+
+	for (const auto& cell_center : cell_centers) {
+		for (size_t i = 0; i < space_dimension; ++i) {
+			if (cell_center[i] < min_coordinate[i])
+				min_coordinate[i] = cell_center[i];
+			if (max_coordinate[i] < cell_center[i])
+				max_coordinate[i] = cell_center[i];
+		}
+	}
+
+	// same scale for every direction so that curve is not stretched
+	auto length = 0.0;
+	for (size_t i = 0; i < space_dimension; ++i) {
+		if (length < max_coordinate[i] - min_coordinate[i])
+			length = max_coordinate[i] - min_coordinate[i];
+	}
+	if (length == 0.0)
+		length = 1.0;
+
+	constexpr auto max_integer_coordinate = static_cast<double>((1u << num_level_) - 1);
+
+	std::vector<std::uint64_t> hilbert_indexes(num_cell);
+	for (size_t i = 0; i < num_cell; ++i) {
+		const auto x = static_cast<std::uint32_t>((cell_centers[i][0] - min_coordinate[0]) / length * max_integer_coordinate);
+		const auto y = static_cast<std::uint32_t>((cell_centers[i][1] - min_coordinate[1]) / length * max_integer_coordinate);
+		hilbert_indexes[i] = hilbert_index(x, y);
+	}
+
+	std::vector<size_t> cell_order(num_cell);
+	std::iota(cell_order.begin(), cell_order.end(), 0);
+	std::stable_sort(cell_order.begin(), cell_order.end(), [&](const size_t i, const size_t j) {return hilbert_indexes[i] < hilbert_indexes[j]; });
+
+	return cell_order;
+}
+
+
+namespace ms {
+	template <typename T>
+	void permute(std::vector<T>& values, const std::vector<size_t>& new_to_old_indexes) {
+		dynamic_require(values.size() == new_to_old_indexes.size(), "permutation should have same size with values");
+
+		std::vector<T> permuted_values;
+		permuted_values.reserve(values.size());
+		for (const auto old_index : new_to_old_indexes)
+			permuted_values.push_back(std::move(values[old_index]));
+
+		values = std::move(permuted_values);
+	}
+}
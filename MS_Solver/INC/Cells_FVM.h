@@ -1,6 +1,12 @@
 #pragma once
 #include "Grid_Builder.h"
 
+#include <algorithm>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <ranges>
+
 //FVM̸  ϴ variable & method
 template <size_t space_dimension>
 class Cells_FVM
@@ -9,7 +15,8 @@ class Cells_FVM
 public:
     Cells_FVM(const Grid<space_dimension>& grid);
 
-    double calculate_time_step(const std::vector<std::array<double, space_dimension>>& coordinate_projected_maximum_lambdas, const double cfl) const;
+    template <typename Projected_Maximum_Lambda_Function>
+    double calculate_time_step(const Projected_Maximum_Lambda_Function& calculate_coordinate_projected_maximum_lambda, const double cfl) const;
 
     template <typename Residual>
     void scale_RHS(std::vector<Residual>& RHS) const;
@@ -35,42 +42,38 @@ template <size_t space_dimension>
 Cells_FVM<space_dimension>::Cells_FVM(const Grid<space_dimension>& grid) {
     SET_TIME_POINT;
 
-    const auto& cell_elements = grid.elements.cell_elements;
-    this->num_cell_ = cell_elements.size();
-
-    this->centers_.reserve(this->num_cell_);
-    this->volumes_.reserve(this->num_cell_);
-    this->coordinate_projected_volumes_.reserve(this->num_cell_);
-    this->residual_scale_factors_.reserve(this->num_cell_);
-    for (const auto& cell_elemnt : cell_elements) {
-        const auto& geometry = cell_elemnt.geometry_;
+    this->num_cell_ = grid.elements.cell_elements.size();
 
-        const auto volume = geometry.volume();
+    this->centers_ = grid.geometry.cell_centers;
+    this->volumes_ = grid.geometry.cell_volumes;
+    this->coordinate_projected_volumes_ = grid.geometry.cell_coordinate_projected_volumes;
 
-        this->centers_.push_back(geometry.center_node());
-        this->volumes_.push_back(volume);
-        this->coordinate_projected_volumes_.push_back(geometry.coordinate_projected_volume());
+    this->residual_scale_factors_.reserve(this->num_cell_);
+    for (const auto volume : this->volumes_)
         this->residual_scale_factors_.push_back(1.0 / volume);
-    }
 
     Log::content_ << std::left << std::setw(50) << "@ Cells FVM precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 };
 
 template <size_t space_dimension>
-double Cells_FVM<space_dimension>::calculate_time_step(const std::vector<std::array<double, space_dimension>>& coordinate_projected_maximum_lambdas, const double cfl) const {
-    std::vector<double> local_time_step(this->num_cell_);
-    for (size_t i = 0; i < this->num_cell_; ++i) {
+template <typename Projected_Maximum_Lambda_Function>
+double Cells_FVM<space_dimension>::calculate_time_step(const Projected_Maximum_Lambda_Function& calculate_coordinate_projected_maximum_lambda, const double cfl) const {
+    // one parallel min reduction over cells, lambdas are evaluated on the fly
+    const auto calculate_local_time_step = [&](const size_t i) {
+        const auto volume = this->volumes_[i];
         const auto [x_projected_volume, y_projected_volume] = this->coordinate_projected_volumes_[i];
-        const auto [x_projeced_maximum_lambda, y_projeced_maximum_lambda] = coordinate_projected_maximum_lambdas[i];
+        const auto [x_projeced_maximum_lambda, y_projeced_maximum_lambda] = calculate_coordinate_projected_maximum_lambda(i);
 
         const auto x_radii = x_projected_volume * x_projeced_maximum_lambda;
         const auto y_radii = y_projected_volume * y_projeced_maximum_lambda;
 
-        local_time_step[i] = cfl * this->volumes_[i] / (x_radii + y_radii);
-    }
+        return cfl * volume / (x_radii + y_radii);
+    };
+    const auto min_time_step = [](const double time_step1, const double time_step2) { return (std::min)(time_step1, time_step2); };
 
-    return *std::min_element(local_time_step.begin(), local_time_step.end());
+    const auto cell_indexes = std::views::iota(size_t{ 0 }, this->num_cell_);
+    return std::transform_reduce(std::execution::par, cell_indexes.begin(), cell_indexes.end(), (std::numeric_limits<double>::max)(), min_time_step, calculate_local_time_step);
 }
 
 template <size_t dim>
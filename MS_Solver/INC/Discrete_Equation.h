@@ -5,6 +5,8 @@
 #include "Solve_Condition.h"
 #include "Post.h"
 
+#include <cstdio>
+
 template <typename Time_Integral_Method>
 class Discrete_Equation
 {
@@ -24,9 +26,17 @@ public:
         Log::content_ << "\t\t\t\t Solving\n";
         Log::content_ << "================================================================================\n\t\t\t\t\t\t";
 
+#ifdef LIMITER_FREEZE_MODE
+        size_t num_update = 0;
+        double initial_residual = 0.0;
+#endif
+
         SET_TIME_POINT;
         while (true) {
             SET_TIME_POINT;
+#ifdef COUNT_HEAP_ALLOCATION
+            const auto num_heap_allocation = GET_NUM_HEAP_ALLOCATION;
+#endif
             auto time_step = semi_discrete_eq.calculate_time_step<Time_Step_Method>(solutions);
              
             if (Solve_End_Condition::inspect(current_time, time_step)) {
@@ -50,7 +60,35 @@ public:
                 current_time += time_step;
             }          
 
-            Log::content_ << "time/update: " << std::to_string(GET_TIME_DURATION) << "s   \t";
+#ifdef LIMITER_FREEZE_MODE
+            if constexpr (SDE::is_limiter_freezable()) {
+                if (!semi_discrete_eq.workspace().is_limiter_frozen)
+                    freeze_limiter_if_converged(semi_discrete_eq.workspace(), ++num_update, initial_residual);
+            }
+#endif
+
+            // update log is formatted in fixed buffer, so counted heap allocations are those of update itself
+            char update_log[256];
+            size_t update_log_length = 0;
+            const auto append_update_log = [&](const char* format, const auto value) {
+                update_log_length += std::snprintf(update_log + update_log_length, sizeof(update_log) - update_log_length, format, value);
+            };
+
+#ifdef TROUBLED_CELL_THRESHOLD
+            auto& workspace = semi_discrete_eq.workspace();
+            if (workspace.num_inspected_cell != 0) {
+                append_update_log("limited cell: %f%%   \t", 100.0 * workspace.num_troubled_cell / workspace.num_inspected_cell);
+                workspace.num_troubled_cell = 0;
+                workspace.num_inspected_cell = 0;
+            }
+#endif
+
+            append_update_log("time/update: %fs   \t", GET_TIME_DURATION);
+#ifdef COUNT_HEAP_ALLOCATION
+            append_update_log("heap allocation/update: %zu   \t", GET_NUM_HEAP_ALLOCATION - num_heap_allocation);
+#endif
+
+            Log::content_ << update_log;
             Log::print();                
         }
 
@@ -59,4 +97,35 @@ public:
         Log::content_ << "================================================================================\n\n";
         Log::print();
     }
+
+private:
+    template <typename Workspace>
+    static void freeze_limiter_if_converged(Workspace& workspace, const size_t num_update, double& initial_residual) {
+        // residual := L2 norm of RHS of last stage
+        double residual = 0.0;
+        for (const auto& RHS : workspace.RHS)
+            residual += RHS.inner_product(RHS);
+        residual = std::sqrt(residual);
+
+        if (num_update == 1)
+            initial_residual = residual;
+
+        bool is_converged = false;
+#ifdef LIMITER_FREEZE_ITERATION
+        is_converged = is_converged || LIMITER_FREEZE_ITERATION <= num_update;
+#endif
+#ifdef LIMITER_FREEZE_RESIDUAL_DROP
+        is_converged = is_converged || residual <= LIMITER_FREEZE_RESIDUAL_DROP * initial_residual;
+#endif
+
+        if (is_converged) {
+            workspace.is_limiter_frozen = true;
+
+            // zero initial residual := steady from first update, residual drop is not defined
+            Log::content_ << "limiter frozen";
+            if (initial_residual != 0.0)
+                Log::content_ << " (residual drop: " << residual / initial_residual << ")";
+            Log::content_ << "   \t";
+        }
+    }
 };
\ No newline at end of file
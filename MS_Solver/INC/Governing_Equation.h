@@ -35,8 +35,8 @@ private:
 public:
     static constexpr auto advection_speed(void) { return advection_speeds_; };
     static Physical_Flux_ physical_flux(const Solution_& solution);
-    static std::vector<Physical_Flux_> physical_fluxes(const std::vector<Solution_>& solutions);
-    static std::vector<std::array<double, space_dimension_>> coordinate_projected_maximum_lambdas(const std::vector<Solution_>& solutions);
+    static void physical_fluxes(const std::vector<Solution_>& solutions, std::vector<Physical_Flux_>& physical_fluxes);
+    static std::array<double, space_dimension_> coordinate_projected_maximum_lambda(const Solution_& solution);
     static double inner_face_maximum_lambda(const Solution_& solution_o, const Solution_& solution_n, const Space_Vector_& nomal_vector);
     static std::string name(void) { return "Linear_Advection_2D"; }; 
 };
@@ -49,8 +49,8 @@ private:
 
 public:
     static Physical_Flux_ physical_flux(const Solution_& solution);
-    static std::vector<Physical_Flux_> physical_fluxes(const std::vector<Solution_>& solutions);
-    static std::vector<std::array<double, space_dimension_>> coordinate_projected_maximum_lambdas(const std::vector<Solution_>& solutions);
+    static void physical_fluxes(const std::vector<Solution_>& solutions, std::vector<Physical_Flux_>& physical_fluxes);
+    static std::array<double, space_dimension_> coordinate_projected_maximum_lambda(const Solution_& solution);
     static double inner_face_maximum_lambda(const Solution_& solution_o, const Solution_& solution_n, const Space_Vector_& nomal_vector);
     static std::string name(void) { return "Burgers_2D"; };    
 };
@@ -72,10 +72,11 @@ private:
 
 public:
     static Solution_ conservative_to_primitive(const Solution_& conservative_variable);
-    static std::vector<std::array<double, space_dimension_>> coordinate_projected_maximum_lambdas(const std::vector<Solution_>& primitive_variables);
+    static void conservative_to_primitive(const std::vector<Solution_>& conservative_variables, std::vector<Solution_>& primitive_variables);
+    static std::array<double, space_dimension_> coordinate_projected_maximum_lambda(const Solution_& primitive_variable);
     static Physical_Flux_ physical_flux(const Solution_& conservative_variable);
     static Physical_Flux_ physical_flux(const Solution_& conservative_variable, const Solution_& primitivie_variable);
-    static std::vector<Physical_Flux_> physical_fluxes(const std::vector<Solution_>& conservative_variables, const std::vector<Solution_>& primitive_variables);
+    static void physical_fluxes(const std::vector<Solution_>& conservative_variables, const std::vector<Solution_>& primitive_variables, std::vector<Physical_Flux_>& physical_fluxes);
     static double inner_face_maximum_lambda(const Solution_& oc_primitive_variable, const Solution_& nc_primitive_variable, const Space_Vector_& nomal_vector);
     
     static constexpr size_t space_dimension(void) { return space_dimension_; };
@@ -2,29 +2,36 @@
 #include "Grid_Builder.h"
 
 template <size_t num_equation, size_t space_dimension>
-class Least_Square_Base
+class Gradient_Method_Base
 {
 public:    
     static constexpr size_t space_dimension_    = space_dimension;
     static constexpr size_t num_equation_       = num_equation;
     
-    using Solution_ = EuclideanVector<num_equation>;
+    using Solution_             = EuclideanVector<num_equation>;
+    using Solution_Gradient_    = Matrix<num_equation, space_dimension>;
 
 protected:
-    size_t num_cell_;
-    std::vector<std::vector<size_t>> near_cell_indexes_set_;
-    std::vector<Dynamic_Matrix_> least_square_matrixes_;
+    using Weight_ = std::array<double, space_dimension>;
+
+    // gradient operator in compressed form : gradient of cell i := sum_j (solution of near_cell_indexes_[j] - solution of i) * weights_[j]
+    size_t num_cell_ = 0;
+    std::vector<size_t> start_indexes_;    // near cells of cell i := near_cell_indexes_[start_indexes_[i] ~ start_indexes_[i + 1])
+    std::vector<size_t> near_cell_indexes_;
+    std::vector<Weight_> weights_;
 
 public:
-    std::vector<Dynamic_Matrix_> calculate_solution_gradients(const std::vector<Solution_>& solutions) const;
+    void calculate_solution_gradients(const std::vector<Solution_>& solutions, std::vector<Solution_Gradient_>& solution_gradients) const;
+    Solution_Gradient_ calculate_solution_gradient(const std::vector<Solution_>& solutions, const size_t cell_index) const;
 
 protected:
-    std::vector<Dynamic_Matrix_> calculate_solution_delta_matrixes(const std::vector<Solution_>& solutions) const;
+    void set_weights(const std::vector<std::vector<size_t>>& near_cell_indexes_set, const std::vector<std::vector<Weight_>>& weights_set);
+    void set_least_square_weights(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::vector<size_t>>& near_cell_indexes_set);
 };
 
 
 template <size_t num_equation, size_t space_dimension>
-class Vertex_Least_Square : public Least_Square_Base<num_equation, space_dimension>
+class Vertex_Least_Square : public Gradient_Method_Base<num_equation, space_dimension>
 {
 public:
     Vertex_Least_Square(const Grid<space_dimension>& grid);
@@ -34,7 +41,7 @@ public:
 
 
 template <size_t num_equation, size_t space_dimension>
-class Face_Least_Square : public Least_Square_Base<num_equation, space_dimension>
+class Face_Least_Square : public Gradient_Method_Base<num_equation, space_dimension>
 {
 public:
     Face_Least_Square(const Grid<space_dimension>& grid);
@@ -43,40 +50,104 @@ public:
 };
 
 
+// face neighbor delta form of green gauss : gradient := 1 / volume * sum_f (face solution - solution) * normal * area
+// face solution is interpolated along center to center line and corrected by skewness of face center from the line, boundary face solution is extrapolated
+// skewness and boundary terms depend on gradient itself, so they are solved per cell once and folded into weights (exact for linear solution on any grid)
+template <size_t num_equation, size_t space_dimension>
+class Green_Gauss : public Gradient_Method_Base<num_equation, space_dimension>
+{
+public:
+    Green_Gauss(const Grid<space_dimension>& grid);
+
+    static std::string name(void) { return "Green_Gauss"; };
+};
+
+
 
 //template definition part
 template <size_t num_equation, size_t space_dimension>
-std::vector<Dynamic_Matrix_> Least_Square_Base<num_equation, space_dimension>::calculate_solution_gradients(const std::vector<Solution_>& solutions) const {
-    std::vector<Dynamic_Matrix_> solution_gradients;
-    solution_gradients.reserve(this->num_cell_);
+void Gradient_Method_Base<num_equation, space_dimension>::calculate_solution_gradients(const std::vector<Solution_>& solutions, std::vector<Solution_Gradient_>& solution_gradients) const {
+    solution_gradients.resize(this->num_cell_);
 
-    const auto solution_delta_matrixes = this->calculate_solution_delta_matrixes(solutions);
-
-    for (size_t i = 0; i < this->num_cell_; ++i)
-        solution_gradients.push_back(solution_delta_matrixes[i] * this->least_square_matrixes_[i]);
+    const auto cell_indexes = std::views::iota(size_t{ 0 }, this->num_cell_);
+    std::for_each(std::execution::par, cell_indexes.begin(), cell_indexes.end(), [&](const size_t i) {
+        solution_gradients[i] = this->calculate_solution_gradient(solutions, i);
+    });
+}
 
-    return solution_gradients;
+template <size_t num_equation, size_t space_dimension>
+Gradient_Method_Base<num_equation, space_dimension>::Solution_Gradient_ Gradient_Method_Base<num_equation, space_dimension>::calculate_solution_gradient(const std::vector<Solution_>& solutions, const size_t cell_index) const {
+    const auto& solution = solutions[cell_index];
+
+    // gradient := solution delta matrix * least square matrix, accumulated directly to avoid temporary matrixes
+    Solution_Gradient_ solution_gradient;
+    for (size_t j = this->start_indexes_[cell_index]; j < this->start_indexes_[cell_index + 1]; ++j) {
+        const auto& near_solution = solutions[this->near_cell_indexes_[j]];
+        const auto& weight = this->weights_[j];
+        for (size_t k = 0; k < num_equation; ++k) {
+            const auto solution_delta = near_solution[k] - solution[k];
+            for (size_t l = 0; l < space_dimension; ++l)
+                solution_gradient.at(k, l) += solution_delta * weight[l];
+        }
+    }
+    return solution_gradient;
 }
 
 template <size_t num_equation, size_t space_dimension>
-std::vector<Dynamic_Matrix_> Least_Square_Base<num_equation, space_dimension>::calculate_solution_delta_matrixes(const std::vector<Solution_>& solutions) const {
-    std::vector<Dynamic_Matrix_> solution_delta_matrixes;
-    solution_delta_matrixes.reserve(this->num_cell_);
+void Gradient_Method_Base<num_equation, space_dimension>::set_least_square_weights(const std::vector<EuclideanVector<space_dimension>>& cell_centers, const std::vector<std::vector<size_t>>& near_cell_indexes_set) {
+    const auto num_cell = cell_centers.size();
+    std::vector<std::vector<Weight_>> weights_set(num_cell);
 
-    for (size_t i = 0; i < this->num_cell_; ++i) {
-        const auto& near_cell_indexes = this->near_cell_indexes_set_.at(i);
-        const auto num_near_cell = near_cell_indexes.size();
-
-        Dynamic_Matrix_ solution_delta_matrix(num_equation, num_near_cell);
-        for (size_t j = 0; j < num_near_cell; ++j) {
-            const auto solution_delta = solutions[near_cell_indexes[j]] - solutions[i];
-            for (size_t k = 0; k < num_equation; ++k)
-                solution_delta_matrix.at(k, j) = solution_delta[k];
+    for (size_t i = 0; i < num_cell; ++i) {
+        const auto& near_cell_indexes = near_cell_indexes_set[i];
+        const auto num_neighbor_cell = near_cell_indexes.size();
+
+        const auto& this_center = cell_centers[i];
+
+        // least square matrix := RcT * (Rc * RcT)^-1, where column j of Rc is center to center vector r_j
+        // Rc * RcT = sum_j r_j * r_j^T is symmetric, so row j of least square matrix = ((Rc * RcT)^-1 * r_j)^T
+        std::vector<EuclideanVector<space_dimension>> center_to_centers;
+        center_to_centers.reserve(num_neighbor_cell);
+
+        Matrix<space_dimension, space_dimension> normal_matrix;
+        for (size_t j = 0; j < num_neighbor_cell; ++j) {
+            const auto center_to_center = cell_centers[near_cell_indexes[j]] - this_center;
+
+            normal_matrix.add_outer_product(center_to_center, center_to_center);
+            center_to_centers.push_back(center_to_center);
+        }
+
+        const auto inverse_normal_matrix = normal_matrix.inverse();
+
+        auto& weights = weights_set[i];
+        weights.resize(num_neighbor_cell);
+        for (size_t j = 0; j < num_neighbor_cell; ++j) {
+            const auto weight = inverse_normal_matrix * center_to_centers[j];
+            for (size_t k = 0; k < space_dimension; ++k)
+                weights[j][k] = weight[k];
         }
-        solution_delta_matrixes.push_back(std::move(solution_delta_matrix));
     }
 
-    return solution_delta_matrixes;
+    this->set_weights(near_cell_indexes_set, weights_set);
+}
+
+template <size_t num_equation, size_t space_dimension>
+void Gradient_Method_Base<num_equation, space_dimension>::set_weights(const std::vector<std::vector<size_t>>& near_cell_indexes_set, const std::vector<std::vector<Weight_>>& weights_set) {
+    this->num_cell_ = near_cell_indexes_set.size();
+
+    this->start_indexes_.resize(this->num_cell_ + 1, 0);
+    for (size_t i = 0; i < this->num_cell_; ++i)
+        this->start_indexes_[i + 1] = this->start_indexes_[i] + near_cell_indexes_set[i].size();
+
+    const auto num_weight = this->start_indexes_.back();
+    this->near_cell_indexes_.reserve(num_weight);
+    this->weights_.reserve(num_weight);
+
+    for (size_t i = 0; i < this->num_cell_; ++i) {
+        dynamic_require(near_cell_indexes_set[i].size() == weights_set[i].size(), "each near cell should have weight");
+        this->near_cell_indexes_.insert(this->near_cell_indexes_.end(), near_cell_indexes_set[i].begin(), near_cell_indexes_set[i].end());
+        this->weights_.insert(this->weights_.end(), weights_set[i].begin(), weights_set[i].end());
+    }
 }
 
 template <size_t num_equation, size_t space_dimension>
@@ -84,48 +155,30 @@ Vertex_Least_Square<num_equation, space_dimension>::Vertex_Least_Square(const Gr
     SET_TIME_POINT;
 
     const auto& cell_elements = grid.elements.cell_elements;
-    const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
+    const auto& vnode_to_cell_csr = grid.connectivity.vnode_to_cell_csr;
 
-    this->num_cell_ = cell_elements.size();
-    this->near_cell_indexes_set_.reserve(this->num_cell_);
-    this->least_square_matrixes_.reserve(this->num_cell_);
+    const auto num_cell = cell_elements.size();
+    std::vector<std::vector<size_t>> near_cell_indexes_set;
+    near_cell_indexes_set.reserve(num_cell);
 
-    for (size_t i = 0; i < this->num_cell_; ++i) {
+    for (size_t i = 0; i < num_cell; ++i) {
         const auto& element = cell_elements[i];
-        const auto& geometry = cell_elements[i].geometry_;
 
         // near cell indexes - vertex
         auto vnode_indexes = element.vertex_node_indexes();
-        std::set<size_t> near_cell_indexes_temp;
+        std::vector<size_t> near_cell_indexes;
         for (const auto vnode_index : vnode_indexes) {
-            const auto& share_cell_indexes = vnode_index_to_share_cell_indexes.at(vnode_index);
-            near_cell_indexes_temp.insert(share_cell_indexes.begin(), share_cell_indexes.end());
-        }
-        near_cell_indexes_temp.erase(i);
-        std::vector<size_t> near_cell_indexes(near_cell_indexes_temp.begin(), near_cell_indexes_temp.end());
-
-        //least square matrix
-        const auto num_neighbor_cell = near_cell_indexes.size();
-
-        const auto this_center = geometry.center_node();
-
-        Dynamic_Matrix_ center_to_center_matrix(space_dimension, num_neighbor_cell);
-        for (size_t i = 0; i < num_neighbor_cell; ++i) {
-            const auto& neighbor_geometry = cell_elements[near_cell_indexes[i]].geometry_;
-            const auto neighbor_center = neighbor_geometry.center_node();
-            const auto center_to_center = neighbor_center - this_center;
-            for (size_t j = 0; j < space_dimension; ++j)
-                center_to_center_matrix.at(j, i) = center_to_center[j];
+            const auto share_cell_indexes = vnode_to_cell_csr.share_cell_indexes(vnode_index);
+            near_cell_indexes.insert(near_cell_indexes.end(), share_cell_indexes.begin(), share_cell_indexes.end());
         }
-
-        const auto& Rc = center_to_center_matrix;
-        auto RcT = Rc.transpose();
-        auto least_square_matrix = RcT * (Rc * RcT).be_inverse();
-
-        this->near_cell_indexes_set_.push_back(std::move(near_cell_indexes));
-        this->least_square_matrixes_.push_back(std::move(least_square_matrix));
+        std::sort(near_cell_indexes.begin(), near_cell_indexes.end());
+        near_cell_indexes.erase(std::unique(near_cell_indexes.begin(), near_cell_indexes.end()), near_cell_indexes.end());
+        near_cell_indexes.erase(std::find(near_cell_indexes.begin(), near_cell_indexes.end(), i));
+        near_cell_indexes_set.push_back(std::move(near_cell_indexes));
     }
 
+    this->set_least_square_weights(grid.geometry.cell_centers, near_cell_indexes_set);
+
     Log::content_ << std::left << std::setw(50) << "@ Vertex Least Sqaure precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 }
@@ -137,15 +190,14 @@ Face_Least_Square<num_equation, space_dimension>::Face_Least_Square(const Grid<s
     SET_TIME_POINT;
 
     const auto& cell_elements = grid.elements.cell_elements;
-    const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
+    const auto& vnode_to_cell_csr = grid.connectivity.vnode_to_cell_csr;
 
-    this->num_cell_ = cell_elements.size();
-    this->near_cell_indexes_set_.reserve(this->num_cell_);
-    this->least_square_matrixes_.reserve(this->num_cell_);
+    const auto num_cell = cell_elements.size();
+    std::vector<std::vector<size_t>> near_cell_indexes_set;
+    near_cell_indexes_set.reserve(num_cell);
 
-    for (size_t i = 0; i < this->num_cell_; ++i) {
+    for (size_t i = 0; i < num_cell; ++i) {
         const auto& element = cell_elements[i];
-        const auto& geometry = cell_elements[i].geometry_;
 
         // near cell indexes - face
         const auto face_vnode_indexes_set = element.face_vertex_node_indexes_set();
@@ -159,14 +211,14 @@ Face_Least_Square<num_equation, space_dimension>::Face_Least_Square(const Grid<s
 
             const auto num_face_vnode = face_vnode_indexes.size();
 
-            const auto& set_0 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[0]);
-            const auto& set_1 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[1]);
+            const auto set_0 = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[0]);
+            const auto set_1 = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[1]);
             std::set_intersection(set_0.begin(), set_0.end(), set_1.begin(), set_1.end(), std::back_inserter(this_face_share_cell_indexes));
 
             if (2 < num_face_vnode) {
                 std::vector<size_t> buffer;
                 for (size_t i = 2; i < num_face_vnode; ++i) {
-                    const auto& set_i = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[i]);
+                    const auto set_i = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[i]);
 
                     buffer.clear();
                     std::set_intersection(this_face_share_cell_indexes.begin(), this_face_share_cell_indexes.end(), set_i.begin(), set_i.end(), std::back_inserter(buffer));
@@ -180,28 +232,99 @@ Face_Least_Square<num_equation, space_dimension>::Face_Least_Square(const Grid<s
             face_share_cell_indexes.push_back(this_face_share_cell_indexes.front());
         }
 
-        //least square matrix
-        const auto num_neighbor_cell = face_share_cell_indexes.size();
+        near_cell_indexes_set.push_back(std::move(face_share_cell_indexes));
+    }
 
-        const auto this_center = geometry.center_node();
+    this->set_least_square_weights(grid.geometry.cell_centers, near_cell_indexes_set);
 
-        Dynamic_Matrix_ center_to_center_matrix(space_dimension, num_neighbor_cell);
-        for (size_t i = 0; i < num_neighbor_cell; ++i) {
-            const auto& neighbor_geometry = cell_elements[face_share_cell_indexes[i]].geometry_;
-            const auto neighbor_center = neighbor_geometry.center_node();
-            const auto center_to_center = neighbor_center - this_center;
-            for (size_t j = 0; j < space_dimension; ++j)
-                center_to_center_matrix.at(j, i) = center_to_center[j];
-        }
+    Log::content_ << std::left << std::setw(50) << "@ Face Least Sqaure precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
+    Log::print();
+}
 
-        const auto& Rc = center_to_center_matrix;
-        auto RcT = Rc.transpose();
-        auto least_square_matrix = RcT * (Rc * RcT).be_inverse();
 
-        this->near_cell_indexes_set_.push_back(std::move(face_share_cell_indexes));
-        this->least_square_matrixes_.push_back(std::move(least_square_matrix));
+template <size_t num_equation, size_t space_dimension>
+Green_Gauss<num_equation, space_dimension>::Green_Gauss(const Grid<space_dimension>& grid) {
+    SET_TIME_POINT;
+
+    const auto& connectivity = grid.connectivity;
+    const auto& geometry = grid.geometry;
+
+    using Space_Vector_ = EuclideanVector<space_dimension>;
+    using Space_Matrix_ = Matrix<space_dimension, space_dimension>;
+
+    const auto num_cell = grid.elements.cell_elements.size();
+    std::vector<std::vector<size_t>> near_cell_indexes_set(num_cell);
+    std::vector<std::vector<Space_Vector_>> delta_weights_set(num_cell);
+    std::vector<Space_Matrix_> correction_matrixes(num_cell);
+
+    const auto& volumes = geometry.cell_volumes;
+    const auto& centers = geometry.cell_centers;
+
+    // face solution := solution at x_f' + gradient * (x_f - x_f'), where x_f' is projection of face center x_f onto center to center line
+    // solution at x_f' is interpolated linearly along the line, the skewness term is moved to left hand side as correction matrix
+    // normal points outward of owner cell, so neighbor cell takes opposite sign
+    const auto add_face = [&](const size_t oc_index, const size_t nc_index, const Space_Vector_& oc_side_face_center, const Space_Vector_& nc_side_face_center, const double area, const Space_Vector_& normal) {
+        const auto& oc_center = centers[oc_index];
+        const auto nc_center = centers[nc_index] + (oc_side_face_center - nc_side_face_center);   // periodic neighbor is shifted to owner side
+
+        const auto center_to_center = nc_center - oc_center;
+        const auto oc_ratio = (oc_side_face_center - oc_center).inner_product(center_to_center) / center_to_center.inner_product(center_to_center);
+        const auto nc_ratio = 1.0 - oc_ratio;
+        const auto skewness = oc_side_face_center - (oc_center + oc_ratio * center_to_center);
+
+        near_cell_indexes_set[oc_index].push_back(nc_index);
+        delta_weights_set[oc_index].push_back(normal * (oc_ratio * area / volumes[oc_index]));
+        correction_matrixes[oc_index].add_outer_product(normal * (area / volumes[oc_index]), skewness);
+
+        near_cell_indexes_set[nc_index].push_back(oc_index);
+        delta_weights_set[nc_index].push_back(normal * (-nc_ratio * area / volumes[nc_index]));
+        correction_matrixes[nc_index].add_outer_product(normal * (-area / volumes[nc_index]), skewness);
+    };
+
+    const auto num_inner_face = geometry.inner_face_centers.size();
+    for (size_t i = 0; i < num_inner_face; ++i) {
+        const auto [oc_index, nc_index] = connectivity.inner_face_oc_nc_index_pairs[i];
+        const auto& inner_face_center = geometry.inner_face_centers[i];
+        add_face(oc_index, nc_index, inner_face_center, inner_face_center, geometry.inner_face_areas[i], connectivity.inner_face_normals[i]);
     }
 
-    Log::content_ << std::left << std::setw(50) << "@ Face Least Sqaure precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
+    const auto num_periodic_boundary = geometry.periodic_boundary_oc_nc_side_centers.size();
+    for (size_t i = 0; i < num_periodic_boundary; ++i) {
+        const auto [oc_index, nc_index] = connectivity.periodic_boundary_oc_nc_index_pairs[i];
+        const auto& [oc_side_face_center, nc_side_face_center] = geometry.periodic_boundary_oc_nc_side_centers[i];
+        add_face(oc_index, nc_index, oc_side_face_center, nc_side_face_center, geometry.periodic_boundary_areas[i], connectivity.periodic_boundary_normals[i]);
+    }
+
+    // boundary face solution is extrapolated by gradient of owner cell, so it only adds to correction matrix
+    const auto num_boundary = geometry.boundary_centers.size();
+    for (size_t i = 0; i < num_boundary; ++i) {
+        const auto oc_index = connectivity.boundary_oc_indexes[i];
+        const auto center_to_face = geometry.boundary_centers[i] - centers[oc_index];
+        correction_matrixes[oc_index].add_outer_product(connectivity.boundary_normals[i] * (geometry.boundary_areas[i] / volumes[oc_index]), center_to_face);
+    }
+
+    // (I - correction matrix) * gradient = sum_j delta weight_j * solution delta_j
+    std::vector<std::vector<typename Green_Gauss::Weight_>> weights_set(num_cell);
+    for (size_t i = 0; i < num_cell; ++i) {
+        auto system_matrix = correction_matrixes[i] * -1.0;
+        for (size_t d = 0; d < space_dimension; ++d)
+            system_matrix.at(d, d) += 1.0;
+
+        dynamic_require(system_matrix.determinant() > 0.0, "green gauss skewness correction matrix should be invertible");
+        const auto inverse_system_matrix = system_matrix.inverse();
+
+        const auto& delta_weights = delta_weights_set[i];
+        auto& weights = weights_set[i];
+        weights.resize(delta_weights.size());
+        for (size_t j = 0; j < delta_weights.size(); ++j) {
+            const auto weight = inverse_system_matrix * delta_weights[j];
+            for (size_t k = 0; k < space_dimension; ++k)
+                weights[j][k] = weight[k];
+        }
+    }
+
+    this->set_weights(near_cell_indexes_set, weights_set);
+
+    Log::content_ << std::left << std::setw(50) << "@ Green Gauss precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 }
\ No newline at end of file
@@ -1,16 +1,31 @@
 #pragma once
+#include "Cell_Ordering.h"
 #include "Grid_Element_Builder.h"
 
+#include <bit>
+#include <cstdint>
+#include <execution>
+#include <ranges>
 #include <set>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 
 
+struct Vnode_To_Cell_CSR	// compressed vnode to share cell table, vnode := node at vertex
+{
+	std::vector<size_t> start_indexes;		// share cells of vnode i := cell_indexes[start_indexes[i] ~ start_indexes[i + 1]), ascending
+	std::vector<size_t> cell_indexes;
+
+	size_t num_vnode(void) const;
+	std::span<const size_t> share_cell_indexes(const size_t vnode_index) const;
+};
+
+
 template <size_t space_dimension>
 struct Grid_Connectivity
 {
-	std::unordered_map<size_t, std::set<size_t>> vnode_index_to_share_cell_indexes; // vnode				:= node at vertex, 
-																					// share_cell_indexes	:= cell indexes which shares vnode
+	Vnode_To_Cell_CSR vnode_to_cell_csr;
 	std::vector<size_t> boundary_oc_indexes;
 	std::vector<EuclideanVector<space_dimension>> boundary_normals;
 
@@ -22,11 +37,42 @@ struct Grid_Connectivity
 };
 
 
+template <size_t space_dimension>
+struct Grid_Geometry		// geometry metrics calculated once after grid build and referenced by every consumer
+{
+	std::vector<EuclideanVector<space_dimension>> cell_centers;
+	std::vector<double> cell_volumes;
+	std::vector<std::array<double, space_dimension>> cell_coordinate_projected_volumes;
+
+	std::vector<EuclideanVector<space_dimension>> boundary_centers;
+	std::vector<double> boundary_areas;
+
+	std::vector<std::pair<EuclideanVector<space_dimension>, EuclideanVector<space_dimension>>> periodic_boundary_oc_nc_side_centers;	// {owner side center, neighbor side center}
+	std::vector<double> periodic_boundary_areas;
+
+	std::vector<EuclideanVector<space_dimension>> inner_face_centers;
+	std::vector<double> inner_face_areas;
+};
+
+
 template <size_t space_dimension>
 struct Grid
 {
 	Grid_Elements<space_dimension> elements;
 	Grid_Connectivity<space_dimension> connectivity;
+	Grid_Geometry<space_dimension> geometry;
+};
+
+
+struct Cell_To_Face_CSR		// compressed cell to face table for gather form residual assembly
+{
+	std::vector<size_t> cell_indexes;		// cells which have at least one face
+	std::vector<size_t> start_indexes;		// faces of cell_indexes[i] := face_indexes[start_indexes[i] ~ start_indexes[i + 1])
+	std::vector<size_t> face_indexes;
+	std::vector<double> coefficients;		// -area for owner cell, +area for neighbor cell
+
+	template <typename Residual, typename Flux>
+	void gather(std::vector<Residual>& RHS, const std::vector<Flux>& face_fluxes) const;
 };
 
 
@@ -40,43 +86,230 @@ public:
 	template <typename Grid_File_Type>
 	static Grid<space_dimension> build(const std::string& grid_file_name);
 
+	template <typename Cell_Ordering>
+	static void renumber(Grid<space_dimension>& grid);	// reorder cells and sort faces by owner cell for memory locality
+
 private:
-	static Grid_Connectivity<space_dimension> make_grid_connectivity(const Grid_Elements<space_dimension>& grid_elements);
-	static std::vector<size_t> find_cell_indexes_have_these_vnodes(const std::unordered_map<size_t, std::set<size_t>>& vertex_node_index_to_cell_container_indexes, const std::vector<size_t>& face_node_indexes);
+	static Grid_Geometry<space_dimension> make_grid_geometry(const Grid_Elements<space_dimension>& grid_elements);
+	static Grid_Connectivity<space_dimension> make_grid_connectivity(const Grid_Elements<space_dimension>& grid_elements, const Grid_Geometry<space_dimension>& grid_geometry);
+	static std::vector<size_t> find_cell_indexes_have_these_vnodes(const Vnode_To_Cell_CSR& vnode_to_cell_csr, const std::vector<size_t>& face_node_indexes);
 };
 
 
+namespace ms {
+	Vnode_To_Cell_CSR make_vnode_to_cell_csr(const std::vector<std::pair<size_t, size_t>>& vnode_cell_index_pairs);
+
+	template <typename Face_Cell_Index>
+	std::vector<std::vector<size_t>> color_faces(const size_t num_cell, const std::vector<Face_Cell_Index>& face_cell_indexes);
+
+	template <typename Face_Cell_Index>
+	Cell_To_Face_CSR make_cell_to_face_csr(const size_t num_cell, const std::vector<Face_Cell_Index>& face_cell_indexes, const std::vector<double>& areas);
+}
+
+
 //template definition part
+template <typename Residual, typename Flux>
+void Cell_To_Face_CSR::gather(std::vector<Residual>& RHS, const std::vector<Flux>& face_fluxes) const {
+	// each cell only writes its own residual, so cells can be gathered concurrently
+	const auto indexes = std::views::iota(size_t{ 0 }, this->cell_indexes.size());
+	std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
+		const auto cell_index = this->cell_indexes[i];
+		for (size_t j = this->start_indexes[i]; j < this->start_indexes[i + 1]; ++j)
+			RHS[cell_index] += this->coefficients[j] * face_fluxes[this->face_indexes[j]];
+	});
+}
+
+
 template <size_t space_dimension>
 template <typename Grid_File_Type>
 Grid<space_dimension> Grid_Builder<space_dimension>::build(const std::string& grid_file_name) {
 	static_require(ms::is_grid_file_type<Grid_File_Type>, "It should be grid file type");
 
 	const auto grid_elements		= Grid_Element_Builder<Grid_File_Type, space_dimension>::build_from_grid_file(grid_file_name);
-	const auto grid_connectivity	= make_grid_connectivity(grid_elements);
-	return { grid_elements,grid_connectivity };
+	const auto grid_geometry		= make_grid_geometry(grid_elements);
+	const auto grid_connectivity	= make_grid_connectivity(grid_elements, grid_geometry);
+	return { grid_elements,grid_connectivity,grid_geometry };
 }
 
 
 template <size_t space_dimension>
-Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_connectivity(const Grid_Elements<space_dimension>& grid_elements) {
+template <typename Cell_Ordering>
+void Grid_Builder<space_dimension>::renumber(Grid<space_dimension>& grid) {
+	static_require(ms::is_cell_ordering<Cell_Ordering>, "It should be cell ordering");
+
+	if constexpr (std::is_same_v<Cell_Ordering, Original_Order>)
+		return;
+	else {
+		SET_TIME_POINT;
+
+		auto& [cell_elements, boundary_elements, periodic_boundary_element_pairs, inner_face_elements] = grid.elements;
+		auto& [vnode_to_cell_csr, boundary_oc_indexes, boundary_normals, periodic_boundary_oc_nc_index_pairs, periodic_boundary_normals, inner_face_oc_nc_index_pairs, inner_face_normals] = grid.connectivity;
+		auto& [cell_centers, cell_volumes, cell_coordinate_projected_volumes, boundary_centers, boundary_areas, periodic_boundary_oc_nc_side_centers, periodic_boundary_areas, inner_face_centers, inner_face_areas] = grid.geometry;
+
+		const auto num_cell = cell_elements.size();
+
+		auto adjacent_cell_index_pairs = inner_face_oc_nc_index_pairs;
+		adjacent_cell_index_pairs.insert(adjacent_cell_index_pairs.end(), periodic_boundary_oc_nc_index_pairs.begin(), periodic_boundary_oc_nc_index_pairs.end());
+		const auto bandwidth_before = ms::calculate_bandwidth(adjacent_cell_index_pairs);
+
+		//renumber cells
+		const auto cell_order = Cell_Ordering::calculate_cell_order(cell_centers, adjacent_cell_index_pairs);
+		dynamic_require(cell_order.size() == num_cell, "cell ordering should include every cell");
+
+		std::vector<size_t> old_to_new_cell_indexes(num_cell);
+		for (size_t i = 0; i < num_cell; ++i)
+			old_to_new_cell_indexes[cell_order[i]] = i;
+
+		ms::permute(cell_elements, cell_order);
+		ms::permute(cell_centers, cell_order);
+		ms::permute(cell_volumes, cell_order);
+		ms::permute(cell_coordinate_projected_volumes, cell_order);
+
+		auto& [vnode_start_indexes, share_cell_indexes] = vnode_to_cell_csr;
+		for (auto& cell_index : share_cell_indexes)
+			cell_index = old_to_new_cell_indexes[cell_index];
+
+		const auto num_vnode = vnode_to_cell_csr.num_vnode();
+		for (size_t i = 0; i < num_vnode; ++i)
+			std::sort(share_cell_indexes.begin() + vnode_start_indexes[i], share_cell_indexes.begin() + vnode_start_indexes[i + 1]);
+
+		for (auto& oc_index : boundary_oc_indexes)
+			oc_index = old_to_new_cell_indexes[oc_index];
+
+		for (auto& [oc_index, nc_index] : periodic_boundary_oc_nc_index_pairs) {
+			oc_index = old_to_new_cell_indexes[oc_index];
+			nc_index = old_to_new_cell_indexes[nc_index];
+		}
+
+		for (auto& [oc_index, nc_index] : inner_face_oc_nc_index_pairs) {
+			oc_index = old_to_new_cell_indexes[oc_index];
+			nc_index = old_to_new_cell_indexes[nc_index];
+		}
+
+		//sort faces by owner cell
+		const auto sort_face_order = [](const size_t num_face, const auto& owner_cell_less) {
+			std::vector<size_t> face_order(num_face);
+			std::iota(face_order.begin(), face_order.end(), 0);
+			std::stable_sort(face_order.begin(), face_order.end(), owner_cell_less);
+			return face_order;
+		};
+
+		const auto boundary_order = sort_face_order(boundary_oc_indexes.size(), [&](const size_t i, const size_t j) {return boundary_oc_indexes[i] < boundary_oc_indexes[j]; });
+		ms::permute(boundary_elements, boundary_order);
+		ms::permute(boundary_oc_indexes, boundary_order);
+		ms::permute(boundary_normals, boundary_order);
+		ms::permute(boundary_centers, boundary_order);
+		ms::permute(boundary_areas, boundary_order);
+
+		const auto periodic_boundary_order = sort_face_order(periodic_boundary_oc_nc_index_pairs.size(), [&](const size_t i, const size_t j) {return periodic_boundary_oc_nc_index_pairs[i] < periodic_boundary_oc_nc_index_pairs[j]; });
+		ms::permute(periodic_boundary_element_pairs, periodic_boundary_order);
+		ms::permute(periodic_boundary_oc_nc_index_pairs, periodic_boundary_order);
+		ms::permute(periodic_boundary_normals, periodic_boundary_order);
+		ms::permute(periodic_boundary_oc_nc_side_centers, periodic_boundary_order);
+		ms::permute(periodic_boundary_areas, periodic_boundary_order);
+
+		const auto inner_face_order = sort_face_order(inner_face_oc_nc_index_pairs.size(), [&](const size_t i, const size_t j) {return inner_face_oc_nc_index_pairs[i] < inner_face_oc_nc_index_pairs[j]; });
+		ms::permute(inner_face_elements, inner_face_order);
+		ms::permute(inner_face_oc_nc_index_pairs, inner_face_order);
+		ms::permute(inner_face_normals, inner_face_order);
+		ms::permute(inner_face_centers, inner_face_order);
+		ms::permute(inner_face_areas, inner_face_order);
+
+		adjacent_cell_index_pairs = inner_face_oc_nc_index_pairs;
+		adjacent_cell_index_pairs.insert(adjacent_cell_index_pairs.end(), periodic_boundary_oc_nc_index_pairs.begin(), periodic_boundary_oc_nc_index_pairs.end());
+		const auto bandwidth_after = ms::calculate_bandwidth(adjacent_cell_index_pairs);
+
+		Log::content_ << std::left << std::setw(50) << "@ Renumber cells by " + Cell_Ordering::name() << " ----------- " << GET_TIME_DURATION << "s\n";
+		Log::content_ << "  bandwidth " << bandwidth_before << " -> " << bandwidth_after << "\n\n";
+		Log::print();
+	}
+}
+
+
+template <size_t space_dimension>
+Grid_Geometry<space_dimension> Grid_Builder<space_dimension>::make_grid_geometry(const Grid_Elements<space_dimension>& grid_elements) {
 	SET_TIME_POINT;
 
 	const auto& [cell_elements, boundary_elements, periodic_boundary_element_pairs, inner_face_elements] = grid_elements;
 
-	std::unordered_map<size_t, std::set<size_t>> vnode_index_to_share_cell_indexes;
+	const auto num_cell = cell_elements.size();
+	const auto num_boundary = boundary_elements.size();
+	const auto num_pbdry_pair = periodic_boundary_element_pairs.size();
+	const auto num_inner_face = inner_face_elements.size();
+
+	Grid_Geometry<space_dimension> grid_geometry;
+	grid_geometry.cell_centers.resize(num_cell);
+	grid_geometry.cell_volumes.resize(num_cell);
+	grid_geometry.cell_coordinate_projected_volumes.resize(num_cell);
+	grid_geometry.boundary_centers.resize(num_boundary);
+	grid_geometry.boundary_areas.resize(num_boundary);
+	grid_geometry.periodic_boundary_oc_nc_side_centers.resize(num_pbdry_pair);
+	grid_geometry.periodic_boundary_areas.resize(num_pbdry_pair);
+	grid_geometry.inner_face_centers.resize(num_inner_face);
+	grid_geometry.inner_face_areas.resize(num_inner_face);
+
+	// every element writes only its own metrics, so elements can be calculated concurrently
+	const auto cell_indexes = std::views::iota(size_t{ 0 }, num_cell);
+	std::for_each(std::execution::par, cell_indexes.begin(), cell_indexes.end(), [&](const size_t i) {
+		const auto& geometry = cell_elements[i].geometry_;
+
+		grid_geometry.cell_centers[i] = geometry.center_node();
+		grid_geometry.cell_volumes[i] = geometry.volume();
+		grid_geometry.cell_coordinate_projected_volumes[i] = geometry.coordinate_projected_volume();
+	});
+
+	const auto boundary_indexes = std::views::iota(size_t{ 0 }, num_boundary);
+	std::for_each(std::execution::par, boundary_indexes.begin(), boundary_indexes.end(), [&](const size_t i) {
+		const auto& boundary_element = boundary_elements[i];
+
+		grid_geometry.boundary_centers[i] = boundary_element.geometry_.center_node();
+		grid_geometry.boundary_areas[i] = boundary_element.geometry_.volume();
+	});
 
+	const auto pbdry_pair_indexes = std::views::iota(size_t{ 0 }, num_pbdry_pair);
+	std::for_each(std::execution::par, pbdry_pair_indexes.begin(), pbdry_pair_indexes.end(), [&](const size_t i) {
+		const auto& [oc_side_element, nc_side_element] = periodic_boundary_element_pairs[i];
+
+		grid_geometry.periodic_boundary_oc_nc_side_centers[i] = { oc_side_element.geometry_.center_node(), nc_side_element.geometry_.center_node() };
+		grid_geometry.periodic_boundary_areas[i] = oc_side_element.geometry_.volume();
+	});
+
+	const auto inner_face_indexes = std::views::iota(size_t{ 0 }, num_inner_face);
+	std::for_each(std::execution::par, inner_face_indexes.begin(), inner_face_indexes.end(), [&](const size_t i) {
+		const auto& inner_face_element = inner_face_elements[i];
+
+		grid_geometry.inner_face_centers[i] = inner_face_element.geometry_.center_node();
+		grid_geometry.inner_face_areas[i] = inner_face_element.geometry_.volume();
+	});
+
+	Log::content_ << std::left << std::setw(50) << "@ Calculate geometry metrics" << " ----------- " << GET_TIME_DURATION << "s\n\n";
+	Log::print();
+
+	return grid_geometry;
+}
+
+
+template <size_t space_dimension>
+Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_connectivity(const Grid_Elements<space_dimension>& grid_elements, const Grid_Geometry<space_dimension>& grid_geometry) {
+	SET_TIME_POINT;
+
+	const auto& [cell_elements, boundary_elements, periodic_boundary_element_pairs, inner_face_elements] = grid_elements;
+	const auto& cell_centers = grid_geometry.cell_centers;
+
+	//vnode to share cell table, cells are visited in ascending order so that every row is sorted
 	const auto num_cell = cell_elements.size();
+
+	std::vector<std::pair<size_t, size_t>> vnode_cell_index_pairs;
+	vnode_cell_index_pairs.reserve(num_cell * (space_dimension == 2 ? 4 : 8));
+
 	for (size_t i = 0; i < num_cell; ++i) {
 		const auto vnode_indexes = cell_elements[i].vertex_node_indexes();
-		for (const auto& vnode_index : vnode_indexes) {
-			if (vnode_index_to_share_cell_indexes.find(vnode_index) == vnode_index_to_share_cell_indexes.end())
-				vnode_index_to_share_cell_indexes.emplace(vnode_index, std::set<size_t>());
-
-			vnode_index_to_share_cell_indexes.at(vnode_index).insert(i);
-		}
+		for (const auto vnode_index : vnode_indexes)
+			vnode_cell_index_pairs.push_back({ vnode_index, i });
 	}
 
+	auto vnode_to_cell_csr = ms::make_vnode_to_cell_csr(vnode_cell_index_pairs);
+
 	//boudnary grid connectivity
 	const auto num_boundary = boundary_elements.size();
 	std::vector<size_t> boudnary_oc_indexes(num_boundary);
@@ -86,12 +319,11 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		const auto& boundary_element = boundary_elements[i];
 
 		const auto vnode_indexes = boundary_element.vertex_node_indexes();
-		const auto oc_indexes = find_cell_indexes_have_these_vnodes(vnode_index_to_share_cell_indexes, vnode_indexes);
+		const auto oc_indexes = find_cell_indexes_have_these_vnodes(vnode_to_cell_csr, vnode_indexes);
 		dynamic_require(oc_indexes.size() == 1, "boundary should have unique owner cell");
 
 		const auto oc_index = oc_indexes.front();
-		const auto& oc_element = cell_elements.at(oc_index);
-		const auto oc_center = oc_element.geometry_.center_node();
+		const auto& oc_center = cell_centers[oc_index];
 
 		const auto boundary_normal = boundary_element.geometry_.normal_vector(oc_center);
 
@@ -107,8 +339,8 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 	for (size_t i = 0; i < num_pbdry_pair; ++i) {
 		const auto& [i_pbdry_element, j_pbdry_element] = periodic_boundary_element_pairs[i];
 
-		const auto cell_indexes_have_i = find_cell_indexes_have_these_vnodes(vnode_index_to_share_cell_indexes, i_pbdry_element.vertex_node_indexes());
-		const auto cell_indexes_have_j = find_cell_indexes_have_these_vnodes(vnode_index_to_share_cell_indexes, j_pbdry_element.vertex_node_indexes());
+		const auto cell_indexes_have_i = find_cell_indexes_have_these_vnodes(vnode_to_cell_csr, i_pbdry_element.vertex_node_indexes());
+		const auto cell_indexes_have_j = find_cell_indexes_have_these_vnodes(vnode_to_cell_csr, j_pbdry_element.vertex_node_indexes());
 		dynamic_require(cell_indexes_have_i.size() == 1, "periodic boundary should have unique owner cell");
 		dynamic_require(cell_indexes_have_j.size() == 1, "periodic boundary should have unique neighbor cell");
 
@@ -116,8 +348,7 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		const auto oc_index = cell_indexes_have_i.front();
 		const auto nc_index = cell_indexes_have_j.front();
 
-		const auto& oc_element = cell_elements[oc_index];
-		const auto oc_center = oc_element.geometry_.center_node();
+		const auto& oc_center = cell_centers[oc_index];
 
 		const auto pbdry_normal = i_pbdry_element.geometry_.normal_vector(oc_center);
 
@@ -125,7 +356,18 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		periodic_boundary_normals[i] = pbdry_normal;
 	}
 
-	// update vnode_index_to_share_cell_indexes
+	// periodic vnodes also share cells across periodic boundary, merged on temporary sets of periodic vnodes only
+	std::unordered_map<size_t, std::set<size_t>> periodic_vnode_index_to_share_cell_indexes;
+
+	const auto periodic_vnode_share_cell_indexes = [&](const size_t vnode_index) -> std::set<size_t>& {
+		const auto [iter, is_new_vnode] = periodic_vnode_index_to_share_cell_indexes.try_emplace(vnode_index);
+		if (is_new_vnode) {
+			const auto share_cell_indexes = vnode_to_cell_csr.share_cell_indexes(vnode_index);
+			iter->second.insert(share_cell_indexes.begin(), share_cell_indexes.end());
+		}
+		return iter->second;
+	};
+
 	for (size_t i = 0; i < num_pbdry_pair; ++i) {
 		const auto [oc_index, nc_index] = periodic_boundary_oc_nc_index_pairs[i];
 		const auto& [oc_side_element, nc_side_element] = periodic_boundary_element_pairs[i];
@@ -134,11 +376,11 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		const auto nc_side_vnode_indexes = nc_side_element.vertex_node_indexes();
 
 		for (const auto vnode_index : oc_side_vnode_indexes) {
-			auto& vnode_share_cell_indexes = vnode_index_to_share_cell_indexes.at(vnode_index);
+			auto& vnode_share_cell_indexes = periodic_vnode_share_cell_indexes(vnode_index);
 			vnode_share_cell_indexes.insert(nc_index);
 		}
 		for (const auto vnode_index : nc_side_vnode_indexes) {
-			auto& cell_container_indexes = vnode_index_to_share_cell_indexes.at(vnode_index);
+			auto& cell_container_indexes = periodic_vnode_share_cell_indexes(vnode_index);
 			cell_container_indexes.insert(oc_index);
 		}
 	}
@@ -147,9 +389,9 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		const auto& [oc_side_element, nc_side_element] = periodic_boundary_element_pairs[i];
 
 		const auto periodic_vnode_index_pairs = oc_side_element.find_periodic_vnode_index_pairs(nc_side_element);
-		for (const auto [i_vnode_index, j_vnode_index] : periodic_vnode_index_pairs) {
-			auto& i_vnode_share_cell_indexes = vnode_index_to_share_cell_indexes.at(i_vnode_index);
-			auto& j_vnode_share_cell_indexes = vnode_index_to_share_cell_indexes.at(j_vnode_index);
+		for (const auto& [i_vnode_index, j_vnode_index] : periodic_vnode_index_pairs) {
+			auto& i_vnode_share_cell_indexes = periodic_vnode_share_cell_indexes(i_vnode_index);
+			auto& j_vnode_share_cell_indexes = periodic_vnode_share_cell_indexes(j_vnode_index);
 
 			if (i_vnode_share_cell_indexes != j_vnode_share_cell_indexes) {
 				i_vnode_share_cell_indexes.insert(j_vnode_share_cell_indexes.begin(), j_vnode_share_cell_indexes.end());
@@ -158,6 +400,25 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 		}
 	}
 
+	if (!periodic_vnode_index_to_share_cell_indexes.empty()) {
+		vnode_cell_index_pairs.clear();
+
+		const auto num_vnode = vnode_to_cell_csr.num_vnode();
+		for (size_t i = 0; i < num_vnode; ++i) {
+			const auto iter = periodic_vnode_index_to_share_cell_indexes.find(i);
+			if (iter != periodic_vnode_index_to_share_cell_indexes.end()) {
+				for (const auto cell_index : iter->second)
+					vnode_cell_index_pairs.push_back({ i, cell_index });
+			}
+			else {
+				for (const auto cell_index : vnode_to_cell_csr.share_cell_indexes(i))
+					vnode_cell_index_pairs.push_back({ i, cell_index });
+			}
+		}
+
+		vnode_to_cell_csr = ms::make_vnode_to_cell_csr(vnode_cell_index_pairs);
+	}
+
 
 	//inner face grid connectivity
 	const auto num_inner_face = inner_face_elements.size();
@@ -167,15 +428,14 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 	for (size_t i = 0; i < num_inner_face; ++i) {
 		const auto& inner_face_element = inner_face_elements[i];
 
-		const auto cell_indexes = find_cell_indexes_have_these_vnodes(vnode_index_to_share_cell_indexes, inner_face_element.vertex_node_indexes());
+		const auto cell_indexes = find_cell_indexes_have_these_vnodes(vnode_to_cell_csr, inner_face_element.vertex_node_indexes());
 		dynamic_require(cell_indexes.size() == 2, "inner face should have owner cell and neighbor cell");
 
 		//set first index as oc index
 		const auto oc_index = cell_indexes[0];
 		const auto nc_index = cell_indexes[1];
 
-		const auto& oc_element = cell_elements[oc_index];
-		const auto oc_center = oc_element.geometry_.center_node();
+		const auto& oc_center = cell_centers[oc_index];
 
 		const auto inner_face_normal = inner_face_element.geometry_.normal_vector(oc_center);
 
@@ -187,7 +447,7 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 	Log::print();
 
 	return {
-		vnode_index_to_share_cell_indexes,
+		std::move(vnode_to_cell_csr),
 		boudnary_oc_indexes, boundary_normals,
 		periodic_boundary_oc_nc_index_pairs, periodic_boundary_normals,
 		inner_face_oc_nc_index_pairs, inner_face_normals };
@@ -195,15 +455,108 @@ Grid_Connectivity<space_dimension> Grid_Builder<space_dimension>::make_grid_conn
 
 
 template<size_t space_dimension>
-std::vector<size_t> Grid_Builder<space_dimension>::find_cell_indexes_have_these_vnodes(const std::unordered_map<size_t, std::set<size_t>>& vertex_node_index_to_cell_container_indexes, const std::vector<size_t>& face_node_indexes) {
+std::vector<size_t> Grid_Builder<space_dimension>::find_cell_indexes_have_these_vnodes(const Vnode_To_Cell_CSR& vnode_to_cell_csr, const std::vector<size_t>& face_node_indexes) {
 	const auto start_node_index = face_node_indexes[0];
 	const auto end_node_index = face_node_indexes[1];
 
-	const auto& indexes_have_start_node = vertex_node_index_to_cell_container_indexes.at(start_node_index);
-	const auto& indexes_have_end_node = vertex_node_index_to_cell_container_indexes.at(end_node_index);
+	const auto indexes_have_start_node = vnode_to_cell_csr.share_cell_indexes(start_node_index);
+	const auto indexes_have_end_node = vnode_to_cell_csr.share_cell_indexes(end_node_index);
 
 	std::vector<size_t> cell_continaer_indexes_have_these_nodes;
 	std::set_intersection(indexes_have_start_node.begin(), indexes_have_start_node.end(), indexes_have_end_node.begin(), indexes_have_end_node.end(), std::back_inserter(cell_continaer_indexes_have_these_nodes));
 
 	return cell_continaer_indexes_have_these_nodes;
+}
+
+
+//template function definition
+namespace ms {
+	template <typename Face_Cell_Index>
+	std::vector<std::vector<size_t>> color_faces(const size_t num_cell, const std::vector<Face_Cell_Index>& face_cell_indexes) {
+		// greedy coloring : faces in same color do not share any cell, so each color can be scattered concurrently
+		std::vector<std::uint64_t> cell_index_to_used_colors(num_cell, 0);
+		std::vector<std::vector<size_t>> same_color_face_indexes_set;
+
+		const auto num_face = face_cell_indexes.size();
+		for (size_t i = 0; i < num_face; ++i) {
+			std::uint64_t used_colors;
+			if constexpr (std::is_same_v<Face_Cell_Index, size_t>)
+				used_colors = cell_index_to_used_colors[face_cell_indexes[i]];
+			else {
+				const auto [oc_index, nc_index] = face_cell_indexes[i];
+				used_colors = cell_index_to_used_colors[oc_index] | cell_index_to_used_colors[nc_index];
+			}
+
+			const auto color = static_cast<size_t>(std::countr_one(used_colors));
+			dynamic_require(color < 64, "number of face color should be less than 64");
+
+			if (color == same_color_face_indexes_set.size())
+				same_color_face_indexes_set.push_back({});
+			same_color_face_indexes_set[color].push_back(i);
+
+			const auto color_bit = std::uint64_t{ 1 } << color;
+			if constexpr (std::is_same_v<Face_Cell_Index, size_t>)
+				cell_index_to_used_colors[face_cell_indexes[i]] |= color_bit;
+			else {
+				const auto [oc_index, nc_index] = face_cell_indexes[i];
+				cell_index_to_used_colors[oc_index] |= color_bit;
+				cell_index_to_used_colors[nc_index] |= color_bit;
+			}
+		}
+
+		return same_color_face_indexes_set;
+	}
+
+	template <typename Face_Cell_Index>
+	Cell_To_Face_CSR make_cell_to_face_csr(const size_t num_cell, const std::vector<Face_Cell_Index>& face_cell_indexes, const std::vector<double>& areas) {
+		std::vector<size_t> cell_index_to_num_face(num_cell, 0);
+		for (const auto& face_cell_index : face_cell_indexes) {
+			if constexpr (std::is_same_v<Face_Cell_Index, size_t>)
+				cell_index_to_num_face[face_cell_index]++;
+			else {
+				const auto [oc_index, nc_index] = face_cell_index;
+				cell_index_to_num_face[oc_index]++;
+				cell_index_to_num_face[nc_index]++;
+			}
+		}
+
+		Cell_To_Face_CSR cell_to_face_csr;
+		std::vector<size_t> cell_index_to_row_index(num_cell);
+
+		cell_to_face_csr.start_indexes.push_back(0);
+		for (size_t i = 0; i < num_cell; ++i) {
+			if (cell_index_to_num_face[i] == 0)
+				continue;
+
+			cell_index_to_row_index[i] = cell_to_face_csr.cell_indexes.size();
+			cell_to_face_csr.cell_indexes.push_back(i);
+			cell_to_face_csr.start_indexes.push_back(cell_to_face_csr.start_indexes.back() + cell_index_to_num_face[i]);
+		}
+
+		const auto num_entry = cell_to_face_csr.start_indexes.back();
+		cell_to_face_csr.face_indexes.resize(num_entry);
+		cell_to_face_csr.coefficients.resize(num_entry);
+
+		// faces are filled in ascending order, so gather summation order is deterministic
+		auto row_index_to_fill_index = cell_to_face_csr.start_indexes;
+		const auto fill = [&](const size_t cell_index, const size_t face_index, const double coefficient) {
+			auto& fill_index = row_index_to_fill_index[cell_index_to_row_index[cell_index]];
+			cell_to_face_csr.face_indexes[fill_index] = face_index;
+			cell_to_face_csr.coefficients[fill_index] = coefficient;
+			fill_index++;
+		};
+
+		const auto num_face = face_cell_indexes.size();
+		for (size_t i = 0; i < num_face; ++i) {
+			if constexpr (std::is_same_v<Face_Cell_Index, size_t>)
+				fill(face_cell_indexes[i], i, -areas[i]);
+			else {
+				const auto [oc_index, nc_index] = face_cell_indexes[i];
+				fill(oc_index, i, -areas[i]);
+				fill(nc_index, i, areas[i]);
+			}
+		}
+
+		return cell_to_face_csr;
+	}
 }
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include "Profiler.h"
 #include "Log.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <map>
-#include <unordered_set>
 #include <sstream>
 
 template <size_t space_dimension>
@@ -40,9 +42,8 @@ public:
 	static Grid_Elements<space_dimension> build_from_grid_file(const std::string& grid_file_name);
 
 	//private: for test
-	static Text read_about(std::ifstream& grid_file_stream, const std::string& target);
-	static std::vector<Space_Vector_> make_node_datas(const Text& node_text);
-	static Grid_Elements<space_dimension> make_elements(const Text& element_text, const Text& physical_name_text, const std::vector<Space_Vector_>& node_datas);
+	static std::vector<Space_Vector_> make_node_datas(const Grid_File_Data& grid_file_data);
+	static Grid_Elements<space_dimension> make_elements(const Grid_File_Data& grid_file_data, const std::vector<Space_Vector_>& node_datas);
 	static std::vector<Element<space_dimension>> make_inner_face_elements(const std::vector<Element<space_dimension>>& cell_elements, const std::vector<Element<space_dimension>>& boundary_elements, const std::vector<Element<space_dimension>>& periodic_boundary_elements);
 	static std::vector<std::pair<Element<space_dimension>, Element<space_dimension>>> match_periodic_boundaries(std::vector<Element<space_dimension>>& periodic_boundary_elements);
 };
@@ -62,33 +63,26 @@ Grid_Elements<space_dimension> Grid_Element_Builder<Gmsh, space_dimension>::buil
 	
 	const auto grid_file_path = "RSC/Grid/" + grid_file_name + ".msh";
 
-	std::ifstream grid_file_stream(grid_file_path);
-	dynamic_require(grid_file_stream.is_open(), "fail to open " + grid_file_path);
-	
-	const auto node_text			= read_about(grid_file_stream, "Nodes");
-	const auto node_datas			= make_node_datas(node_text);
-	
-	const auto element_text			= read_about(grid_file_stream, "Elements");	
-	const auto physical_name_text	= read_about(grid_file_stream, "PhysicalNames");
+	const auto grid_file_data	= Gmsh::read_grid_file(grid_file_path);
+	const auto node_datas		= make_node_datas(grid_file_data);
 
 	Log::content_ << std::left << std::setw(50) << "@ Read Grid File" << " ----------- " << GET_TIME_DURATION << "s\n\n";
 	Log::print();
 
-	return make_elements(element_text, physical_name_text, node_datas);
+	return make_elements(grid_file_data, node_datas);
 }
 
 template <size_t space_dimension>
-std::vector<EuclideanVector<space_dimension>> Grid_Element_Builder<Gmsh, space_dimension>::make_node_datas(const Text& node_text) {
-	std::vector<Space_Vector_> node_datas;
-	node_datas.reserve(node_text.size());
-	for (const auto& node_data : node_text) {
-		const char delimiter = ' ';
-		auto parsed_data_set = ms::parse(node_data, delimiter);
+std::vector<EuclideanVector<space_dimension>> Grid_Element_Builder<Gmsh, space_dimension>::make_node_datas(const Grid_File_Data& grid_file_data) {
+	const auto& node_coordinates = grid_file_data.node_coordinates;
+	const auto num_node = node_coordinates.size() / 3;
 
-		//const auto node_index = ms::string_to_value<size_t>(parsed_data_set[0]);
+	std::vector<Space_Vector_> node_datas;
+	node_datas.reserve(num_node);
+	for (size_t i = 0; i < num_node; ++i) {
 		std::array<double, space_dimension> node_coords;
-		for (size_t i = 0; i < space_dimension; ++i)
-			node_coords[i] = ms::string_to_value<double>(parsed_data_set[i + 1]);
+		for (size_t j = 0; j < space_dimension; ++j)
+			node_coords[j] = node_coordinates[3 * i + j];
 
 		node_datas.push_back(node_coords);
 	}
@@ -96,36 +90,21 @@ std::vector<EuclideanVector<space_dimension>> Grid_Element_Builder<Gmsh, space_d
 }
 
 template <size_t space_dimension>
-Grid_Elements<space_dimension> Grid_Element_Builder<Gmsh, space_dimension>::make_elements(const Text& element_text, const Text& physical_name_text, const std::vector<Space_Vector_>& node_datas) {
+Grid_Elements<space_dimension> Grid_Element_Builder<Gmsh, space_dimension>::make_elements(const Grid_File_Data& grid_file_data, const std::vector<Space_Vector_>& node_datas) {
 	SET_TIME_POINT;
 
 	std::map<index, ElementType> physical_group_index_to_element_type;
-	for (const auto& physical_name_sentence : physical_name_text) {
-		const char delimiter = ' ';
-		const auto parsed_sentence_set = ms::parse(physical_name_sentence, delimiter);
-
-		//const size_t dimension		= parsed_sentence_set[0].toValue<size_t>();
-		const auto physical_group_index	= ms::string_to_value<index>(parsed_sentence_set[1]);
-		const auto name					= ms::erase(parsed_sentence_set[2], "\"");
-		const auto element_type			= ms::string_to_element_type(name);
-
-		physical_group_index_to_element_type.emplace(physical_group_index, element_type);
-	}
+	for (const auto& [physical_group_index, name] : grid_file_data.physical_group_index_name_pairs)
+		physical_group_index_to_element_type.emplace(physical_group_index, ms::string_to_element_type(name));
 
 	std::vector<Element<space_dimension>> cell_elements;
 	std::vector<Element<space_dimension>> boundary_elements;
 	std::vector<Element<space_dimension>> periodic_boundary_elements;
-	for (const auto& element_sentence : element_text) {
-		const auto delimiter = ' ';
-		const auto parsed_sentences = ms::parse(element_sentence, delimiter);
 
-		auto value_set = ms::string_to_value_set<index>(parsed_sentences);
-
-		//const auto index					= value_set[0];
-		const auto figure_type_index		= value_set[1];
-		//const auto tag_index				= value_set[2];
-		const auto physical_gorup_index		= value_set[3];
-		//const auto element_group_index	= value_set[4];
+	const auto num_element = grid_file_data.element_figure_type_indexes.size();
+	for (size_t i = 0; i < num_element; ++i) {
+		const auto figure_type_index		= grid_file_data.element_figure_type_indexes[i];
+		const auto physical_gorup_index		= grid_file_data.element_physical_group_indexes[i];
 
 		//reference geometry
 		const auto figure		= Gmsh::figure_type_index_to_element_figure(figure_type_index);
@@ -133,13 +112,8 @@ Grid_Elements<space_dimension> Grid_Element_Builder<Gmsh, space_dimension>::make
 		auto reference_geometry = ReferenceGeometry(figure, figure_order);
 
 		//geometry
-		constexpr size_t num_index = 5;
-		value_set.erase(value_set.begin(), value_set.begin() + num_index);
-
-		const auto num_nodes = value_set.size();
-		std::vector<size_t> node_indexes(num_nodes);
-		for (size_t i = 0; i < num_nodes; ++i)
-			node_indexes[i] = value_set[i] - 1;		//Gmsh node index start with 1
+		const auto node_index_begin = grid_file_data.element_node_indexes.begin();
+		std::vector<size_t> node_indexes(node_index_begin + grid_file_data.element_node_start_indexes[i], node_index_begin + grid_file_data.element_node_start_indexes[i + 1]);
 
 		auto nodes = ms::extract_by_index(node_datas, node_indexes);
 		Geometry geometry(reference_geometry, std::move(nodes));
@@ -176,97 +150,203 @@ Grid_Elements<space_dimension> Grid_Element_Builder<Gmsh, space_dimension>::make
 
 template<size_t space_dimension>
 std::vector<Element<space_dimension>> Grid_Element_Builder<Gmsh, space_dimension>::make_inner_face_elements(const std::vector<Element<space_dimension>>& cell_elements, const std::vector<Element<space_dimension>>& boundary_elements, const std::vector<Element<space_dimension>>& periodic_boundary_elements) {
-	//construct inner face elements
-	std::map<std::vector<size_t>, Element<space_dimension>> vnode_indexes_to_inner_face_element;
+	//construct face elements of every cell, face index increases with cell index
+	std::vector<Element<space_dimension>> face_elements;
+	face_elements.reserve(cell_elements.size() * (space_dimension == 2 ? 4 : 6));
+
 	for (const auto& cell_element : cell_elements) {
-		auto inner_face_elements = cell_element.make_inner_face_elements();
-		for (auto& inner_face_element : inner_face_elements) {
-			auto vnode_indexes = inner_face_element.vertex_node_indexes();
-			std::sort(vnode_indexes.begin(), vnode_indexes.end());	//to ignore index order
-			vnode_indexes_to_inner_face_element.emplace(std::move(vnode_indexes), std::move(inner_face_element));
-		}
+		auto cell_face_elements = cell_element.make_inner_face_elements();
+		face_elements.insert(face_elements.end(), std::make_move_iterator(cell_face_elements.begin()), std::make_move_iterator(cell_face_elements.end()));
 	}
 
-	//erase constructed elements
-	for (const auto& boundray_element : boundary_elements) {
-		auto vnode_indexes = boundray_element.vertex_node_indexes();
-		std::sort(vnode_indexes.begin(), vnode_indexes.end());	//to ignore index order
-		const auto result = vnode_indexes_to_inner_face_element.erase(vnode_indexes);
-		dynamic_require(result == 1, "boundary geometry should be one of inner face");
+	//face key := sorted vertex node indexes padded with max, boundary and periodic boundary keys follow face keys
+	constexpr size_t max_num_face_vertex = space_dimension == 2 ? 2 : 4;
+	using Face_Key = std::array<size_t, max_num_face_vertex>;
+
+	const auto make_face_key = [](const std::vector<size_t>& vnode_indexes) {
+		dynamic_require(vnode_indexes.size() <= max_num_face_vertex, "face should not have more vertex than face key");
+
+		Face_Key key;
+		key.fill((std::numeric_limits<size_t>::max)());
+		std::copy(vnode_indexes.begin(), vnode_indexes.end(), key.begin());
+		std::sort(key.begin(), key.begin() + vnode_indexes.size());	//to ignore index order
+		return key;
+	};
+
+	const auto num_face = face_elements.size();
+
+	std::vector<Face_Key> keys;
+	keys.reserve(num_face + boundary_elements.size() + periodic_boundary_elements.size());
+
+	for (const auto& face_element : face_elements)
+		keys.push_back(make_face_key(face_element.vertex_node_indexes()));
+	for (const auto& boundray_element : boundary_elements)
+		keys.push_back(make_face_key(boundray_element.vertex_node_indexes()));
+	for (const auto& periodic_boundray_element : periodic_boundary_elements)
+		keys.push_back(make_face_key(periodic_boundray_element.vertex_node_indexes()));
+
+	//bucket keys by smallest vertex node index with counting sort, so same faces meet in small bucket and keep index order
+	const auto num_key = keys.size();
+
+	size_t num_vnode = 0;
+	for (const auto& key : keys)
+		num_vnode = key.front() + 1 < num_vnode ? num_vnode : key.front() + 1;
+
+	std::vector<size_t> bucket_start_indexes(num_vnode + 1, 0);
+	for (const auto& key : keys)
+		bucket_start_indexes[key.front() + 1]++;
+	for (size_t i = 0; i < num_vnode; ++i)
+		bucket_start_indexes[i + 1] += bucket_start_indexes[i];
+
+	std::vector<size_t> bucketed_key_indexes(num_key);
+	{
+		auto fill_indexes = bucket_start_indexes;
+		for (size_t i = 0; i < num_key; ++i)
+			bucketed_key_indexes[fill_indexes[keys[i].front()]++] = i;
 	}
-	for (const auto& periodic_boundray_element : periodic_boundary_elements) {
-		auto vnode_indexes = periodic_boundray_element.vertex_node_indexes();
-		std::sort(vnode_indexes.begin(), vnode_indexes.end());	//to ignore index order
-		const auto result = vnode_indexes_to_inner_face_element.erase(vnode_indexes);
-		dynamic_require(result == 1, "periodic boundary geometry should be one of inner face");
+
+	//inner face := face shared by two cells and not by boundary, kept from owner cell which has lower cell index
+	std::vector<bool> is_inner_face(num_face, false);
+	std::vector<bool> is_matched(num_key, false);
+
+	for (size_t i = 0; i < num_vnode; ++i) {
+		const auto bucket_start_index = bucket_start_indexes[i];
+		const auto bucket_end_index = bucket_start_indexes[i + 1];
+
+		for (size_t j = bucket_start_index; j < bucket_end_index; ++j) {
+			const auto key_index = bucketed_key_indexes[j];
+			if (is_matched[key_index])
+				continue;
+
+			//key index in bucket increases, so face of lower cell comes first and boundary comes last
+			size_t num_same_face = 1;
+			size_t last_key_index = key_index;
+			for (size_t k = j + 1; k < bucket_end_index; ++k) {
+				const auto other_key_index = bucketed_key_indexes[k];
+				if (keys[other_key_index] == keys[key_index]) {
+					is_matched[other_key_index] = true;
+					last_key_index = other_key_index;
+					num_same_face++;
+				}
+			}
+
+			if (num_face <= last_key_index) {
+				if (last_key_index < num_face + boundary_elements.size()) {
+					dynamic_require(num_same_face == 2 && key_index < num_face, "boundary geometry should be one of inner face");
+				}
+				else {
+					dynamic_require(num_same_face == 2 && key_index < num_face, "periodic boundary geometry should be one of inner face");
+				}
+			}
+			else {
+				dynamic_require(num_same_face == 2, "inner face should be shared by two cells");
+				is_inner_face[key_index] = true;
+			}
+		}
 	}
 
-	// container change
+	//owner cell order
 	std::vector<Element<space_dimension>> inner_face_elements;
+	inner_face_elements.reserve(num_face / 2);
 
-	const auto num_inner_face = vnode_indexes_to_inner_face_element.size();
-	inner_face_elements.reserve(num_inner_face);
-
-	for (auto&& [key, value] : vnode_indexes_to_inner_face_element)
-		inner_face_elements.push_back(std::move(value));
+	for (size_t i = 0; i < num_face; ++i) {
+		if (is_inner_face[i])
+			inner_face_elements.push_back(std::move(face_elements[i]));
+	}
 
 	return inner_face_elements;
 }
 
 template<size_t space_dimension>
 std::vector<std::pair<Element<space_dimension>, Element<space_dimension>>> Grid_Element_Builder<Gmsh, space_dimension>::match_periodic_boundaries(std::vector<Element<space_dimension>>& periodic_boundary_elements) {
-	
+	//periodic pair := translated along periodic axis, so their centers have same coordinates except periodic axis
+	constexpr auto tolerance = 1.0E-10;
+	using Projected_Center = std::array<double, space_dimension - 1>;
+
 	const auto num_periodic_element = periodic_boundary_elements.size();
 	const auto num_pair = static_cast<size_t>(0.5 * num_periodic_element);
 
-	std::unordered_set<size_t> matched_index;
-	matched_index.reserve(num_periodic_element);
+	std::vector<Projected_Center> projected_centers(num_periodic_element);
+	for (size_t i = 0; i < num_periodic_element; ++i) {
+		const auto& element = periodic_boundary_elements[i];
+		const size_t periodic_axis_tag = element.type() == ElementType::x_periodic ? 0 : 1;
+		const auto center = element.geometry_.center_node();
+
+		auto& projected_center = projected_centers[i];
+		for (size_t j = 0, k = 0; j < space_dimension; ++j) {
+			if (j != periodic_axis_tag)
+				projected_center[k++] = center[j];
+		}
+	}
 
-	std::vector<std::pair<Element<space_dimension>, Element<space_dimension>>> matched_periodic_element_pairs;
-	matched_periodic_element_pairs.reserve(num_pair);
+	//pair candidates become adjacent after sort by type and projected center
+	std::vector<size_t> sorted_indexes(num_periodic_element);
+	for (size_t i = 0; i < num_periodic_element; ++i)
+		sorted_indexes[i] = i;
+
+	std::sort(sorted_indexes.begin(), sorted_indexes.end(), [&](const size_t i, const size_t j) {
+		const auto i_type = periodic_boundary_elements[i].type();
+		const auto j_type = periodic_boundary_elements[j].type();
+		if (i_type != j_type)
+			return i_type < j_type;
+		else
+			return projected_centers[i] < projected_centers[j];
+		});
+
+	const auto is_same_projected_center = [&](const size_t i, const size_t j) {
+		for (size_t k = 0; k < space_dimension - 1; ++k) {
+			if (std::abs(projected_centers[i][k] - projected_centers[j][k]) > tolerance)
+				return false;
+		}
+		return true;
+	};
+
+	//search forward only while first projected coordinate is in tolerance, pair := (lower index, higher index)
+	std::vector<bool> is_matched(num_periodic_element, false);
+	std::vector<std::pair<size_t, size_t>> matched_index_pairs;
+	matched_index_pairs.reserve(num_pair);
 
 	for (size_t i = 0; i < num_periodic_element; ++i) {
-		if (matched_index.find(i) != matched_index.end())
+		const auto i_index = sorted_indexes[i];
+		if (is_matched[i_index])
 			continue;
 
+		const auto& i_element = periodic_boundary_elements[i_index];
 		for (size_t j = i + 1; j < num_periodic_element; ++j) {
-			if (matched_index.find(j) != matched_index.end())
-				continue;
+			const auto j_index = sorted_indexes[j];
+			const auto& j_element = periodic_boundary_elements[j_index];
+
+			if (j_element.type() != i_element.type() || projected_centers[j_index][0] - projected_centers[i_index][0] > tolerance)
+				break;
 
-			auto& i_element = periodic_boundary_elements[i];
-			auto& j_element = periodic_boundary_elements[j];
+			if (is_matched[j_index] || !is_same_projected_center(i_index, j_index))
+				continue;
 
 			if (i_element.is_periodic_pair(j_element)) {
-				matched_periodic_element_pairs.push_back(std::make_pair(std::move(i_element), std::move(j_element)));
-				matched_index.insert(i);
-				matched_index.insert(j);
+				matched_index_pairs.push_back(std::minmax(i_index, j_index));
+				is_matched[i_index] = true;
+				is_matched[j_index] = true;
 				break;
 			}
 		}
-	}
-
-	return matched_periodic_element_pairs;
-}
 
+		dynamic_require(is_matched[i_index], "periodic boundary should have its pair");
+	}
 
+	//keep pair order of input
+	std::sort(matched_index_pairs.begin(), matched_index_pairs.end());
 
-template <size_t space_dimension>
-Text Grid_Element_Builder<Gmsh, space_dimension>::read_about(std::ifstream& grid_file_stream, const std::string& target) {
-	const auto target_str = "$" + target;
+	std::vector<std::pair<Element<space_dimension>, Element<space_dimension>>> matched_periodic_element_pairs;
+	matched_periodic_element_pairs.reserve(num_pair);
 
-	std::string tmp_str;
-	while (std::getline(grid_file_stream, tmp_str)) {
-		if (tmp_str.find(target_str) != std::string::npos) {
-			std::getline(grid_file_stream, tmp_str);
-			break;
-		}
-	}
+	for (const auto& [i_index, j_index] : matched_index_pairs)
+		matched_periodic_element_pairs.push_back(std::make_pair(std::move(periodic_boundary_elements[i_index]), std::move(periodic_boundary_elements[j_index])));
 
-	const auto num_data = ms::string_to_value<size_t>(tmp_str);
-	return Text(grid_file_stream, num_data);
+	return matched_periodic_element_pairs;
 }
 
 
+
 //inline function definition
 namespace ms {
 	inline ElementType string_to_element_type(const std::string& str) {
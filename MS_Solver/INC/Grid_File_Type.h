@@ -1,6 +1,8 @@
 #pragma once
 #include "Element.h"
 
+#include <map>
+#include <string_view>
 #include <type_traits>
 
 using index = unsigned int;
@@ -23,10 +25,55 @@ enum class GmshFigureType
 };
 
 
+// raw data of grid file in flat arrays, node indexes start with 0
+struct Grid_File_Data
+{
+	std::vector<double> node_coordinates;					// coordinates of node i := node_coordinates[3 * i ~ 3 * i + 3)
+	std::vector<index> element_figure_type_indexes;
+	std::vector<index> element_physical_group_indexes;
+	std::vector<size_t> element_node_start_indexes;			// nodes of element i := element_node_indexes[element_node_start_indexes[i] ~ element_node_start_indexes[i + 1])
+	std::vector<size_t> element_node_indexes;
+	std::vector<std::pair<index, std::string>> physical_group_index_name_pairs;
+};
+
+
+// reads format 2.2 and 4.1, both ascii and binary
 class Gmsh : public GFT {
+private:
+	// sequential reader over memory mapped file, ascii values are parsed by from_chars and binary values are copied as they are
+	struct Cursor
+	{
+		const char* position;
+		const char* end;
+		bool is_binary = false;
+
+		template <typename T>
+		T read(void);
+		template <typename T>
+		T read_ascii(void);
+		template <typename T>
+		T read_binary(void);
+		size_t read_size(void);		// gmsh 4 size and tag, 8 byte in binary file
+		void skip_line(void);
+	};
+
+	using Entity_ = std::pair<int, int>;	// (dimension, tag) of gmsh 4 entity
+
 public:
+	static Grid_File_Data read_grid_file(const std::string& grid_file_path);	// every section is parsed in place in one pass
 	static order figure_type_index_to_figure_order(const index figure_type_index);
 	static Figure figure_type_index_to_element_figure(const index figure_type_index);
+	static size_t figure_type_index_to_num_node(const index figure_type_index);
+
+private:
+	static std::string_view read_section_name(Cursor& cursor);
+	static void skip_section(Cursor& cursor, const std::string_view section_name);
+	static void read_physical_names(Cursor& cursor, Grid_File_Data& grid_file_data);
+	static void read_nodes_v2(Cursor& cursor, Grid_File_Data& grid_file_data);
+	static void read_elements_v2(Cursor& cursor, Grid_File_Data& grid_file_data);
+	static void read_entities_v4(Cursor& cursor, std::map<Entity_, index>& entity_to_physical_group_index);
+	static void read_nodes_v4(Cursor& cursor, Grid_File_Data& grid_file_data);
+	static void read_elements_v4(Cursor& cursor, const std::map<Entity_, index>& entity_to_physical_group_index, Grid_File_Data& grid_file_data);
 };
 
 
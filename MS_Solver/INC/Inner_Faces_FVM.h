@@ -1,7 +1,12 @@
 #pragma once
 #include "Grid_Builder.h"
+#include "Numerical_Flux_Function.h"
 #include "Reconstruction_Method.h"
 
+#include <algorithm>
+#include <execution>
+#include <ranges>
+
 
 //FVM̸  ϴ variable
 template <size_t space_dimension>
@@ -15,6 +20,8 @@ protected:
     std::vector<Space_Vector_> normals_;
     std::vector<std::pair<size_t, size_t>> oc_nc_index_pairs_;
     std::vector<double> areas_;
+    std::vector<std::vector<size_t>> same_color_face_indexes_set_;  // faces in same color do not share cell
+    Cell_To_Face_CSR cell_to_face_csr_;
 
 public:
     Inner_Faces_FVM_Base(Grid<space_dimension>&& grid);
@@ -31,8 +38,8 @@ private:
 public:
     Inner_Faces_FVM_Constant(Grid<space_dimension>&& grid) : Inner_Faces_FVM_Base<space_dimension>(std::move(grid)) {};
 
-    template<typename Numerical_Flux_Function, typename Residual, typename Solution>
-    void calculate_RHS(std::vector<Residual>& RHS, const std::vector<Solution>& solutions) const;
+    template<typename Numerical_Flux_Function, size_t num_equation>
+    void calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const std::vector<EuclideanVector<num_equation>>& solutions) const;
 };
 
 
@@ -46,12 +53,13 @@ private:
 
 protected:
     std::vector<std::pair<Space_Vector_, Space_Vector_>> oc_nc_to_face_vector_pairs_;
+    std::vector<std::vector<size_t>> same_color_face_block_start_indexes_set_;     // for batched numerical flux function
 
 public:
     Inner_Faces_FVM_Linear(Grid<space_dimension>&& grid);
 
     template<typename Numerical_Flux_Function, size_t num_equation>
-    void calculate_RHS(std::vector<EuclideanVector<num_equation>>& RHS, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const;
+    void calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const;
 };
 
 
@@ -62,28 +70,39 @@ Inner_Faces_FVM_Base<space_dimension>::Inner_Faces_FVM_Base(Grid<space_dimension
 
     this->num_inner_face_ = grid.elements.inner_face_elements.size();
 
-    this->areas_.reserve(this->num_inner_face_);
-    for (const auto& element : grid.elements.inner_face_elements)
-        this->areas_.push_back(element.geometry_.volume());
-
+    this->areas_ = grid.geometry.inner_face_areas;
     this->normals_ = std::move(grid.connectivity.inner_face_normals);
     this->oc_nc_index_pairs_ = std::move(grid.connectivity.inner_face_oc_nc_index_pairs);
 
+    const auto num_cell = grid.elements.cell_elements.size();
+    this->same_color_face_indexes_set_ = ms::color_faces(num_cell, this->oc_nc_index_pairs_);
+    this->cell_to_face_csr_ = ms::make_cell_to_face_csr(num_cell, this->oc_nc_index_pairs_, this->areas_);
+
     Log::content_ << std::left << std::setw(50) << "@ Inner faces FVM base precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 }
 
 
 template <size_t space_dimension>
-template<typename Numerical_Flux_Function, typename Residual, typename Solution>
-void Inner_Faces_FVM_Constant<space_dimension>::calculate_RHS(std::vector<Residual>& RHS, const std::vector<Solution>& solutions) const {
-    const auto numerical_fluxes = Numerical_Flux_Function::calculate(solutions, this->normals_, this->oc_nc_index_pairs_);
-    for (size_t i = 0; i < this->num_inner_face_; ++i) {
-        const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
-        const auto delta_RHS = this->areas_[i] * numerical_fluxes[i];
-        RHS[oc_index] -= delta_RHS;
-        RHS[nc_index] += delta_RHS;
+template<typename Numerical_Flux_Function, size_t num_equation>
+void Inner_Faces_FVM_Constant<space_dimension>::calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const std::vector<EuclideanVector<num_equation>>& solutions) const {
+    auto& RHS = workspace.RHS;
+
+    Numerical_Flux_Function::calculate(workspace, solutions, this->normals_, this->oc_nc_index_pairs_);
+    const auto& numerical_fluxes = workspace.face_fluxes;
+
+#ifdef RHS_GATHER_MODE
+    this->cell_to_face_csr_.gather(RHS, numerical_fluxes);
+#else
+    for (const auto& same_color_face_indexes : this->same_color_face_indexes_set_) {
+        std::for_each(std::execution::par, same_color_face_indexes.begin(), same_color_face_indexes.end(), [&](const size_t i) {
+            const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
+            const auto delta_RHS = this->areas_[i] * numerical_fluxes[i];
+            RHS[oc_index] -= delta_RHS;
+            RHS[nc_index] += delta_RHS;
+        });
     }
+#endif
 }
 
 
@@ -93,17 +112,13 @@ Inner_Faces_FVM_Linear<space_dimension>::Inner_Faces_FVM_Linear(Grid<space_dimen
 
     this->oc_nc_to_face_vector_pairs_.reserve(this->num_inner_face_);
 
-    const auto& cell_elements = grid.elements.cell_elements;
+    const auto& cell_centers = grid.geometry.cell_centers;
     for (size_t i = 0; i < this->num_inner_face_; ++i) {
         const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
 
-        const auto& oc_geometry = cell_elements[oc_index].geometry_;
-        const auto& nc_geometry = cell_elements[nc_index].geometry_;
-        const auto& inner_face_geometry = grid.elements.inner_face_elements[i].geometry_;
-
-        const auto oc_center = oc_geometry.center_node();
-        const auto nc_center = nc_geometry.center_node();
-        const auto inner_face_center = inner_face_geometry.center_node();
+        const auto& oc_center = cell_centers[oc_index];
+        const auto& nc_center = cell_centers[nc_index];
+        const auto& inner_face_center = grid.geometry.inner_face_centers[i];
 
         const auto oc_to_face_vector = inner_face_center - oc_center;
         const auto nc_to_face_vector = inner_face_center - nc_center;
@@ -111,6 +126,16 @@ Inner_Faces_FVM_Linear<space_dimension>::Inner_Faces_FVM_Linear(Grid<space_dimen
         this->oc_nc_to_face_vector_pairs_.push_back(std::make_pair(oc_to_face_vector, nc_to_face_vector));
     }
 
+    constexpr auto block_size = Face_State_Block<1, space_dimension>::capacity_;
+    this->same_color_face_block_start_indexes_set_.reserve(this->same_color_face_indexes_set_.size());
+    for (const auto& same_color_face_indexes : this->same_color_face_indexes_set_) {
+        std::vector<size_t> block_start_indexes;
+        for (size_t i = 0; i < same_color_face_indexes.size(); i += block_size)
+            block_start_indexes.push_back(i);
+
+        this->same_color_face_block_start_indexes_set_.push_back(std::move(block_start_indexes));
+    }
+
     Log::content_ << std::left << std::setw(50) << "@ Inner faces FVM linear precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 };
@@ -118,11 +143,13 @@ Inner_Faces_FVM_Linear<space_dimension>::Inner_Faces_FVM_Linear(Grid<space_dimen
 
 template <size_t space_dimension>
 template <typename Numerical_Flux_Function, size_t num_equation>
-void Inner_Faces_FVM_Linear<space_dimension>::calculate_RHS(std::vector<EuclideanVector<num_equation>>& RHS, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const {
+void Inner_Faces_FVM_Linear<space_dimension>::calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const {
+    auto& RHS = workspace.RHS;
+
     const auto& solutions = linear_reconstructed_solution.solutions;
     const auto& solution_gradients = linear_reconstructed_solution.solution_gradients;
 
-    for (size_t i = 0; i < this->num_inner_face_; ++i) {
+    const auto reconstruct_face_solutions = [&](const size_t i) {
         const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
         const auto& oc_solution = solutions[oc_index];
         const auto& nc_solution = solutions[nc_index];
@@ -134,11 +161,85 @@ void Inner_Faces_FVM_Linear<space_dimension>::calculate_RHS(std::vector<Euclidea
 
         const auto oc_side_solution = oc_solution + oc_solution_gradient * oc_to_face_vector;
         const auto nc_side_solution = nc_solution + nc_solution_gradient * nc_to_face_vector;
+
+        return std::make_pair(oc_side_solution, nc_side_solution);
+    };
+
+    if constexpr (ms::is_batched_numerical_flux_function<Numerical_Flux_Function>) {
+        using Face_State_Block_ = typename Numerical_Flux_Function::Face_State_Block_;
+
+        const auto num_color = this->same_color_face_indexes_set_.size();
+        for (size_t c = 0; c < num_color; ++c) {
+            const auto& same_color_face_indexes = this->same_color_face_indexes_set_[c];
+            const auto& block_start_indexes = this->same_color_face_block_start_indexes_set_[c];
+
+            std::for_each(std::execution::par, block_start_indexes.begin(), block_start_indexes.end(), [&](const size_t block_start_index) {
+                Face_State_Block_ face_state_block;
+                face_state_block.num_face = (std::min)(Face_State_Block_::capacity_, same_color_face_indexes.size() - block_start_index);
+
+                for (size_t j = 0; j < face_state_block.num_face; ++j) {
+                    const auto i = same_color_face_indexes[block_start_index + j];
+                    const auto [oc_side_solution, nc_side_solution] = reconstruct_face_solutions(i);
+                    const auto& inner_face_normal = this->normals_[i];
+
+                    for (size_t e = 0; e < num_equation; ++e) {
+                        face_state_block.oc_side_solutions[e][j] = oc_side_solution[e];
+                        face_state_block.nc_side_solutions[e][j] = nc_side_solution[e];
+                    }
+                    for (size_t d = 0; d < space_dimension; ++d)
+                        face_state_block.normals[d][j] = inner_face_normal[d];
+                }
+
+                Numerical_Flux_Function::calculate(face_state_block);
+
+                for (size_t j = 0; j < face_state_block.num_face; ++j) {
+                    const auto i = same_color_face_indexes[block_start_index + j];
+
+                    std::array<double, num_equation> numerical_flux_values;
+                    for (size_t e = 0; e < num_equation; ++e)
+                        numerical_flux_values[e] = face_state_block.numerical_fluxes[e][j];
+                    const EuclideanVector<num_equation> numerical_flux = numerical_flux_values;
+
+#ifdef RHS_GATHER_MODE
+                    workspace.face_fluxes[i] = numerical_flux;
+#else
+                    const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
+                    const auto delta_RHS = this->areas_[i] * numerical_flux;
+                    RHS[oc_index] -= delta_RHS;
+                    RHS[nc_index] += delta_RHS;
+#endif
+                }
+            });
+        }
+
+#ifdef RHS_GATHER_MODE
+        this->cell_to_face_csr_.gather(RHS, workspace.face_fluxes);
+#endif
+        return;
+    }
+
+    const auto calculate_numerical_flux = [&](const size_t i) {
+        const auto [oc_side_solution, nc_side_solution] = reconstruct_face_solutions(i);
         const auto& inner_face_normal = this->normals_[i];
 
-        const auto numerical_flux = Numerical_Flux_Function::calculate(oc_side_solution, nc_side_solution, inner_face_normal);
-        const auto delta_RHS = this->areas_[i] * numerical_flux;
-        RHS[oc_index] -= delta_RHS;
-        RHS[nc_index] += delta_RHS;
+        return Numerical_Flux_Function::calculate(oc_side_solution, nc_side_solution, inner_face_normal);
+    };
+
+#ifdef RHS_GATHER_MODE
+    auto& numerical_fluxes = workspace.face_fluxes;
+    const auto indexes = std::views::iota(size_t{ 0 }, this->num_inner_face_);
+    std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
+        numerical_fluxes[i] = calculate_numerical_flux(i);
+    });
+    this->cell_to_face_csr_.gather(RHS, numerical_fluxes);
+#else
+    for (const auto& same_color_face_indexes : this->same_color_face_indexes_set_) {
+        std::for_each(std::execution::par, same_color_face_indexes.begin(), same_color_face_indexes.end(), [&](const size_t i) {
+            const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
+            const auto delta_RHS = this->areas_[i] * calculate_numerical_flux(i);
+            RHS[oc_index] -= delta_RHS;
+            RHS[nc_index] += delta_RHS;
+        });
     }
+#endif
 }
\ No newline at end of file
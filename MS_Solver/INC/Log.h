@@ -23,13 +23,14 @@ public:
 	}
 
 	static void print(void) {
-		auto log_str = Log::content_.str();
+		// buffer of content is moved out and given back, so content of next print is written without allocation
+		auto log_str = std::move(Log::content_).str();
 
 		std::cout << log_str;
-		Log::log_txt_ << std::move(log_str);
+		Log::log_txt_ << log_str;
 
-		std::ostringstream tmp;
-		Log::content_.swap(tmp);
+		log_str.clear();
+		Log::content_.str(std::move(log_str));
 	}
 
 	static void write(void) {
@@ -21,8 +21,11 @@ public:
 	EuclideanVector<num_row> operator*(const EuclideanVector<num_column>&x) const;
 	bool operator==(const Matrix & A) const;
 
+	Matrix& add_outer_product(const EuclideanVector<num_row>& x, const EuclideanVector<num_column>& y);	// this += x * y^T
 	double& at(const size_t row_index, const size_t column_index);
 	double at(const size_t row_index, const size_t column_index) const;
+	double determinant(void) const;
+	Matrix inverse(void) const;	// closed form up to 3x3, so small matrix does not pay LAPACK call overhead
 	std::string to_string(void) const;
 
 private:
@@ -122,6 +125,14 @@ EuclideanVector<num_row> Matrix<num_row, num_column>::operator*(const EuclideanV
 	return result;
 }
 
+template<size_t num_row, size_t num_column>
+Matrix<num_row, num_column>& Matrix<num_row, num_column>::add_outer_product(const EuclideanVector<num_row>& x, const EuclideanVector<num_column>& y) {
+	for (size_t i = 0; i < num_row; ++i)
+		for (size_t j = 0; j < num_column; ++j)
+			this->values_[i * num_column + j] += x[i] * y[j];
+	return *this;
+}
+
 template<size_t num_row, size_t num_column>
 double& Matrix<num_row, num_column>::at(const size_t row_index, const size_t column_index) {
 	return this->values_[row_index * num_column + column_index];
@@ -132,6 +143,55 @@ double Matrix<num_row, num_column>::at(const size_t row_index, const size_t colu
 	return this->values_[row_index * num_column + column_index];
 }
 
+template<size_t num_row, size_t num_column>
+double Matrix<num_row, num_column>::determinant(void) const {
+	static_require(num_row == num_column, "determinant is defined for square matrix");
+	static_require(1 <= num_row && num_row <= 3, "closed form determinant is implemented up to 3x3 matrix");
+
+	const auto& m = this->values_;
+	if constexpr (num_row == 1)
+		return m[0];
+	else if constexpr (num_row == 2)
+		return m[0] * m[3] - m[1] * m[2];
+	else
+		return m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+template<size_t num_row, size_t num_column>
+Matrix<num_row, num_column> Matrix<num_row, num_column>::inverse(void) const {
+	static_require(num_row == num_column, "invertable matrix should be square matrix");
+	static_require(1 <= num_row && num_row <= 3, "closed form inverse is implemented up to 3x3 matrix");
+
+	const auto det = this->determinant();
+	dynamic_require(det != 0.0, "singular matrix is not invertable");
+	const auto inv_det = 1.0 / det;
+
+	// inverse := adjugate / determinant
+	const auto& m = this->values_;
+	Matrix result;
+	auto& r = result.values_;
+	if constexpr (num_row == 1)
+		r[0] = inv_det;
+	else if constexpr (num_row == 2) {
+		r[0] = m[3] * inv_det;
+		r[1] = -m[1] * inv_det;
+		r[2] = -m[2] * inv_det;
+		r[3] = m[0] * inv_det;
+	}
+	else {
+		r[0] = (m[4] * m[8] - m[5] * m[7]) * inv_det;
+		r[1] = (m[2] * m[7] - m[1] * m[8]) * inv_det;
+		r[2] = (m[1] * m[5] - m[2] * m[4]) * inv_det;
+		r[3] = (m[5] * m[6] - m[3] * m[8]) * inv_det;
+		r[4] = (m[0] * m[8] - m[2] * m[6]) * inv_det;
+		r[5] = (m[2] * m[3] - m[0] * m[5]) * inv_det;
+		r[6] = (m[3] * m[7] - m[4] * m[6]) * inv_det;
+		r[7] = (m[1] * m[6] - m[0] * m[7]) * inv_det;
+		r[8] = (m[0] * m[4] - m[1] * m[3]) * inv_det;
+	}
+	return result;
+}
+
 template<size_t num_row, size_t num_column>
 std::string Matrix<num_row, num_column>::to_string(void) const {
 	std::string result;
@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+
+// read only view of whole file mapped by operating system, so file can be parsed in place without copy into strings
+class Memory_Mapped_File
+{
+public:
+	Memory_Mapped_File(const std::string& file_path);
+	~Memory_Mapped_File(void);
+
+	Memory_Mapped_File(const Memory_Mapped_File&) = delete;
+	Memory_Mapped_File& operator=(const Memory_Mapped_File&) = delete;
+
+	std::string_view view(void) const;
+
+private:
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include "Text.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+
+enum class Activation
+{
+	identity	= 0,
+	relu		= 1,
+	tanh		= 2,
+	sigmoid		= 3,
+};
+
+
+// fully connected network evaluated in process, every call infers whole batch with layer wise matrix multiply
+// weight file := binary, little endian
+//		uint64 num_layer
+//		for each layer : uint64 num_input, uint64 num_output, uint64 activation, double weights[num_input][num_output], double biases[num_output]
+class Neural_Network
+{
+private:
+	struct Layer
+	{
+		size_t num_input = 0;
+		size_t num_output = 0;
+		Activation activation = Activation::identity;
+		std::vector<double> weights;	// weights[i * num_output + o] := weight from input i to output o
+		std::vector<double> biases;
+	};
+
+private:
+	std::vector<Layer> layers_;
+
+	static constexpr size_t batch_block_size_ = 64;		// rows of batch whose outputs stay in cache while one block of weights is swept
+	static constexpr size_t input_block_size_ = 64;
+
+public:
+	Neural_Network(void) = default;
+	Neural_Network(const std::string& weight_file_path);
+
+	size_t num_input(void) const;
+	size_t num_output(void) const;
+
+	// inputs[b * num_input + i] -> outputs[b * num_output + o], layer_output_buffers keep intermediate layer outputs of whole batch
+	void infer(const double* inputs, const size_t num_batch, double* outputs, std::array<std::vector<double>, 2>& layer_output_buffers) const;
+
+private:
+	static void multiply_add(const double* inputs, const size_t num_batch, const Layer& layer, double* outputs);
+	static void activate(const Activation activation, double* values, const size_t num_value);
+};
@@ -1,10 +1,29 @@
 #pragma once
 #include "Governing_Equation.h"
+#include "Solver_Workspace.h"
+
+#include <algorithm>
+#include <execution>
+#include <ranges>
 
 
 class NFF {};    // Numerical Flux Function
 
 
+// reconstructed face states of a block of faces in structure of arrays form
+template <size_t num_equation, size_t space_dimension>
+struct Face_State_Block
+{
+    static constexpr size_t capacity_ = 64;
+
+    size_t num_face = 0;
+    alignas(64) std::array<std::array<double, capacity_>, num_equation> oc_side_solutions;
+    alignas(64) std::array<std::array<double, capacity_>, num_equation> nc_side_solutions;
+    alignas(64) std::array<std::array<double, capacity_>, space_dimension> normals;
+    alignas(64) std::array<std::array<double, capacity_>, num_equation> numerical_fluxes;
+};
+
+
 template <typename Governing_Equation>
 class LLF : public NFF  // Local Lax Fridrich method
 {
@@ -14,9 +33,10 @@ private:
     using Space_Vector_     = typename Governing_Equation::Space_Vector_;
     using Solution_         = typename Governing_Equation::Solution_;
     using Numerical_Flux_   = EuclideanVector<Governing_Equation::num_equation()>;
+    using Solver_Workspace_ = Solver_Workspace<Governing_Equation::num_equation(), Governing_Equation::space_dimension()>;
 
 public:
-    static auto calculate(const std::vector<Solution_>& solutions, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs);
+    static void calculate(Solver_Workspace_& workspace, const std::vector<Solution_>& solutions, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs);  // write to workspace.face_fluxes
     static auto calculate(const Solution_& oc_side_solution, const Solution_& nc_side_solution, const Space_Vector_& normal);
 };
 
@@ -28,30 +48,42 @@ private:
     using Space_Vector_     = typename Euler_2D::Space_Vector_;
     using Solution_         = typename Euler_2D::Solution_;
     using Numerical_Flux_   = EuclideanVector<Euler_2D::num_equation()>;
+    using Solver_Workspace_ = Solver_Workspace<Euler_2D::num_equation(), Euler_2D::space_dimension()>;
 
 public:
-    static std::vector<Numerical_Flux_> calculate(const std::vector<Solution_>& conservative_variables, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs);
+    using Face_State_Block_ = Face_State_Block<Euler_2D::num_equation(), Euler_2D::space_dimension()>;
+
+public:
+    static void calculate(Solver_Workspace_& workspace, const std::vector<Solution_>& conservative_variables, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs);  // read workspace.primitive_variables, write to workspace.face_fluxes
     static Numerical_Flux_ calculate(const Solution_& oc_side_cvariable, const Solution_& nc_side_cvariable, const Space_Vector_& normal);
+    static void calculate(Face_State_Block_& face_state_block);  // write to face_state_block.numerical_fluxes, bitwise identical to face wise calculate
 };
 
 
 namespace ms {
     template <typename T>
     inline constexpr bool is_numeirical_flux_function = std::is_base_of_v<NFF, T>;
+
+    template <typename T>
+    inline constexpr bool is_batched_numerical_flux_function = requires (typename T::Face_State_Block_& face_state_block) { T::calculate(face_state_block); };
 }
 
 
 //template definition part
 template <typename Governing_Equation>
-auto LLF<Governing_Equation>::calculate(const std::vector<Solution_>& solutions, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs) {
+void LLF<Governing_Equation>::calculate(Solver_Workspace_& workspace, const std::vector<Solution_>& solutions, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs) {
     const auto num_inner_face = normals.size();
-    const auto physical_fluxes = Governing_Equation::physical_fluxes(solutions);
 
-    std::vector<Numerical_Flux_> inner_face_numerical_fluxes(num_inner_face);
-    for (size_t i = 0; i < num_inner_face; ++i) {
+    auto& physical_fluxes = workspace.physical_fluxes;
+    Governing_Equation::physical_fluxes(solutions, physical_fluxes);
+
+    // every face writes only its own flux, so faces are calculated concurrently
+    auto& inner_face_numerical_fluxes = workspace.face_fluxes;
+    const auto face_indexes = std::views::iota(size_t{ 0 }, num_inner_face);
+    std::for_each(std::execution::par, face_indexes.begin(), face_indexes.end(), [&](const size_t i) {
         const auto [oc_index, nc_index] = oc_nc_index_pairs[i];
-        const auto oc_physical_flux = physical_fluxes[oc_index];
-        const auto nc_physical_flux = physical_fluxes[nc_index];
+        const auto& oc_physical_flux = physical_fluxes[oc_index];
+        const auto& nc_physical_flux = physical_fluxes[nc_index];
 
         const auto oc_solution = solutions[oc_index];
         const auto nc_solution = solutions[nc_index];
@@ -59,8 +91,7 @@ auto LLF<Governing_Equation>::calculate(const std::vector<Solution_>& solutions,
         const auto inner_face_maximum_lambda = Governing_Equation::inner_face_maximum_lambda(oc_solution, nc_solution, normal);
 
         inner_face_numerical_fluxes[i] = 0.5 * ((oc_physical_flux + nc_physical_flux) * normal + inner_face_maximum_lambda * (oc_solution - nc_solution));
-    }
-    return inner_face_numerical_fluxes;
+    });
 };
 
 template <typename Governing_Equation>
@@ -2,6 +2,9 @@
 #include "Grid_Builder.h"
 #include "Reconstruction_Method.h"
 
+#include <execution>
+#include <ranges>
+
 
 //FVM̸  ϴ variable
 template <size_t space_dimension>
@@ -14,6 +17,8 @@ protected:
     std::vector<Space_Vector_> normals_;
     std::vector<std::pair<size_t, size_t>> oc_nc_index_pairs_;
     std::vector<double> areas_;
+    std::vector<std::vector<size_t>> same_color_pbdry_indexes_set_;  // periodic boundaries in same color do not share cell
+    Cell_To_Face_CSR cell_to_pbdry_csr_;
 
 public:
     Periodic_Boundaries_FVM_Base(Grid<space_dimension>&& grid);
@@ -33,8 +38,8 @@ protected:
 public:
     Periodic_Boundaries_FVM_Constant(Grid<space_dimension>&& grid) : Periodic_Boundaries_FVM_Base<space_dimension>(std::move(grid)) {};
 
-    template<typename Numerical_Flux_Function, typename Residual, typename Solution>
-    void calculate_RHS(std::vector<Residual>& RHS, const std::vector<Solution>& solutions) const;
+    template<typename Numerical_Flux_Function, size_t num_equation>
+    void calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const std::vector<EuclideanVector<num_equation>>& solutions) const;
 };
 
 
@@ -52,7 +57,7 @@ public:
     Periodic_Boundaries_FVM_Linear(Grid<space_dimension>&& grid);
 
     template<typename Numerical_Flux_Function, size_t num_equation>
-    void calculate_RHS(std::vector<EuclideanVector<num_equation>>& RHS, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const;
+    void calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const;
 };
 
 
@@ -64,28 +69,38 @@ Periodic_Boundaries_FVM_Base<space_dimension>::Periodic_Boundaries_FVM_Base(Grid
 
     this->num_pbdry_pair_ = grid.elements.periodic_boundary_element_pairs.size();
 
-    this->areas_.reserve(this->num_pbdry_pair_);
-    for (const auto& [oc_side_element, nc_side_element] : grid.elements.periodic_boundary_element_pairs) {
-        this->areas_.push_back(oc_side_element.geometry_.volume());
-    }
-
+    this->areas_ = grid.geometry.periodic_boundary_areas;
     this->normals_ = std::move(grid.connectivity.periodic_boundary_normals);
     this->oc_nc_index_pairs_ = std::move(grid.connectivity.periodic_boundary_oc_nc_index_pairs);
 
+    const auto num_cell = grid.elements.cell_elements.size();
+    this->same_color_pbdry_indexes_set_ = ms::color_faces(num_cell, this->oc_nc_index_pairs_);
+    this->cell_to_pbdry_csr_ = ms::make_cell_to_face_csr(num_cell, this->oc_nc_index_pairs_, this->areas_);
+
     Log::content_ << std::left << std::setw(50) << "@ Periodic boundaries FVM base precalculation" << " ----------- " << GET_TIME_DURATION << "s\n\n";
     Log::print();
 }
 
 template <size_t space_dimension>
-template<typename Numerical_Flux_Function, typename Residual, typename Solution>
-void Periodic_Boundaries_FVM_Constant<space_dimension>::calculate_RHS(std::vector<Residual>& RHS, const std::vector<Solution>& solutions) const {
-    const auto numerical_fluxes = Numerical_Flux_Function::calculate(solutions, this->normals_, this->oc_nc_index_pairs_);
-    for (size_t i = 0; i < this->num_pbdry_pair_; ++i) {
-        const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
-        const auto delta_RHS = this->areas_[i] * numerical_fluxes[i];
-        RHS[oc_index] -= delta_RHS;
-        RHS[nc_index] += delta_RHS;
+template<typename Numerical_Flux_Function, size_t num_equation>
+void Periodic_Boundaries_FVM_Constant<space_dimension>::calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const std::vector<EuclideanVector<num_equation>>& solutions) const {
+    auto& RHS = workspace.RHS;
+
+    Numerical_Flux_Function::calculate(workspace, solutions, this->normals_, this->oc_nc_index_pairs_);
+    const auto& numerical_fluxes = workspace.face_fluxes;
+
+#ifdef RHS_GATHER_MODE
+    this->cell_to_pbdry_csr_.gather(RHS, numerical_fluxes);
+#else
+    for (const auto& same_color_pbdry_indexes : this->same_color_pbdry_indexes_set_) {
+        std::for_each(std::execution::par, same_color_pbdry_indexes.begin(), same_color_pbdry_indexes.end(), [&](const size_t i) {
+            const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
+            const auto delta_RHS = this->areas_[i] * numerical_fluxes[i];
+            RHS[oc_index] -= delta_RHS;
+            RHS[nc_index] += delta_RHS;
+        });
     }
+#endif
 }
 
 template <size_t space_dimension>
@@ -94,21 +109,13 @@ Periodic_Boundaries_FVM_Linear<space_dimension>::Periodic_Boundaries_FVM_Linear(
 
     this->oc_nc_to_oc_nc_side_face_vector_pairs_.reserve(this->num_pbdry_pair_);
 
-    const auto& cell_elements = grid.elements.cell_elements;
-    const auto& pbdry_element_pairs = grid.elements.periodic_boundary_element_pairs;
+    const auto& cell_centers = grid.geometry.cell_centers;
     for (size_t i = 0; i < this->num_pbdry_pair_; ++i) {
         const auto& [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
-        const auto& oc_geometry = cell_elements[oc_index].geometry_;
-        const auto& nc_geometry = cell_elements[nc_index].geometry_;
-
-        const auto& [oc_side_element, nc_side_element] = pbdry_element_pairs[i];
-        const auto& oc_side_geometry = oc_side_element.geometry_;
-        const auto& nc_side_geometry = nc_side_element.geometry_;
+        const auto& oc_center = cell_centers[oc_index];
+        const auto& nc_center = cell_centers[nc_index];
 
-        const auto oc_center = oc_geometry.center_node();
-        const auto nc_center = nc_geometry.center_node();
-        const auto oc_side_center = oc_side_geometry.center_node();
-        const auto nc_side_center = nc_side_geometry.center_node();
+        const auto& [oc_side_center, nc_side_center] = grid.geometry.periodic_boundary_oc_nc_side_centers[i];
 
         const auto oc_to_oc_side_face_vector = oc_side_center - oc_center;
         const auto nc_to_nc_side_face_vector = nc_side_center - nc_center;
@@ -122,11 +129,13 @@ Periodic_Boundaries_FVM_Linear<space_dimension>::Periodic_Boundaries_FVM_Linear(
 
 template <size_t space_dimension>
 template <typename Numerical_Flux_Function, size_t num_equation>
-void Periodic_Boundaries_FVM_Linear<space_dimension>::calculate_RHS(std::vector<EuclideanVector<num_equation>>& RHS, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const {
+void Periodic_Boundaries_FVM_Linear<space_dimension>::calculate_RHS(Solver_Workspace<num_equation, space_dimension>& workspace, const Linear_Reconstructed_Solution<num_equation, space_dimension>& linear_reconstructed_solution) const {
+    auto& RHS = workspace.RHS;
+
     const auto& solutions = linear_reconstructed_solution.solutions;
     const auto& solution_gradients = linear_reconstructed_solution.solution_gradients;
 
-    for (size_t i = 0; i < this->num_pbdry_pair_; ++i) {
+    const auto calculate_numerical_flux = [&](const size_t i) {
         const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
         const auto& oc_solution = solutions[oc_index];
         const auto& nc_solution = solutions[nc_index];
@@ -140,9 +149,24 @@ void Periodic_Boundaries_FVM_Linear<space_dimension>::calculate_RHS(std::vector<
         const auto nc_side_solution = nc_solution + nc_solution_gradient * nc_to_nc_side_face_vector;
         const auto& pbdry_normal = this->normals_[i];
 
-        const auto numerical_flux = Numerical_Flux_Function::calculate(oc_side_solution, nc_side_solution, pbdry_normal);
-        const auto delta_RHS = this->areas_[i] * numerical_flux;
-        RHS[oc_index] -= delta_RHS;
-        RHS[nc_index] += delta_RHS;
+        return Numerical_Flux_Function::calculate(oc_side_solution, nc_side_solution, pbdry_normal);
+    };
+
+#ifdef RHS_GATHER_MODE
+    auto& numerical_fluxes = workspace.face_fluxes;
+    const auto indexes = std::views::iota(size_t{ 0 }, this->num_pbdry_pair_);
+    std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
+        numerical_fluxes[i] = calculate_numerical_flux(i);
+    });
+    this->cell_to_pbdry_csr_.gather(RHS, numerical_fluxes);
+#else
+    for (const auto& same_color_pbdry_indexes : this->same_color_pbdry_indexes_set_) {
+        std::for_each(std::execution::par, same_color_pbdry_indexes.begin(), same_color_pbdry_indexes.end(), [&](const size_t i) {
+            const auto [oc_index, nc_index] = this->oc_nc_index_pairs_[i];
+            const auto delta_RHS = this->areas_[i] * calculate_numerical_flux(i);
+            RHS[oc_index] -= delta_RHS;
+            RHS[nc_index] += delta_RHS;
+        });
     }
+#endif
 }
\ No newline at end of file
@@ -20,8 +20,8 @@ public:
 	template <size_t space_dimension>
 	static void intialize(const Grid<space_dimension>& grid);
 
-	template <size_t num_equation>
-	static void record_solution_datas(const std::vector<EuclideanVector<num_equation>>& solutions, const std::vector<Dynamic_Matrix_>& solution_gradients);
+	template <size_t num_equation, size_t space_dimension>
+	static void record_solution_datas(const std::vector<EuclideanVector<num_equation>>& solutions, const std::vector<Matrix<num_equation, space_dimension>>& solution_gradients);
 
 	template <size_t num_equation>
 	static void record_limiting_value(const size_t index, const std::array<double, num_equation>& limiting_value);
@@ -38,7 +38,8 @@ public:
 	template <size_t num_equation>
 	static auto convert_to_solution_strings(const std::vector<EuclideanVector<num_equation>>& solutions);
 
-	static std::vector<std::string> convert_to_solution_gradient_strings(const std::vector<Dynamic_Matrix_>& solution_gradients);
+	template <size_t num_equation, size_t space_dimension>
+	static auto convert_to_solution_gradient_strings(const std::vector<Matrix<num_equation, space_dimension>>& solution_gradients);
 };
 
 
@@ -47,7 +48,7 @@ template <size_t space_dimension>
 void PostAI::intialize(const Grid<space_dimension>& grid) {
 #ifdef POST_AI_DATA
 
-	const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
+	const auto& vnode_to_cell_csr = grid.connectivity.vnode_to_cell_csr;
 	const auto& cell_elements = grid.elements.cell_elements;
 	num_data_ = cell_elements.size();
 
@@ -67,7 +68,7 @@ void PostAI::intialize(const Grid<space_dimension>& grid) {
 
 		const auto vnode_indexes = cell_element.vertex_node_indexes();
 		for (const auto& vnode_index : vnode_indexes) {
-			const auto& vnode_share_cell_indexes = vnode_index_to_share_cell_indexes.at(vnode_index);
+			const auto vnode_share_cell_indexes = vnode_to_cell_csr.share_cell_indexes(vnode_index);
 			vertex_share_cell_indexes_temp.insert(vnode_share_cell_indexes.begin(), vnode_share_cell_indexes.end());
 		}
 
@@ -134,8 +135,8 @@ void PostAI::intialize(const Grid<space_dimension>& grid) {
 }
 
 
-template <size_t num_equation>
-void PostAI::record_solution_datas(const std::vector<EuclideanVector<num_equation>>& solutions, const std::vector<Dynamic_Matrix_>& solution_gradients) {
+template <size_t num_equation, size_t space_dimension>
+void PostAI::record_solution_datas(const std::vector<EuclideanVector<num_equation>>& solutions, const std::vector<Matrix<num_equation, space_dimension>>& solution_gradients) {
 #ifdef POST_AI_DATA
 
 	dynamic_require(num_data_ == solutions.size(),			"number of solution should be same with number of data");
@@ -202,7 +203,7 @@ void PostAI::record_limiting_value(const size_t index, const std::array<double,
 
 template <size_t space_dimension>
 auto PostAI::calculate_face_share_cell_indexes_set(const Grid<space_dimension>& grid) {
-	const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
+	const auto& vnode_to_cell_csr = grid.connectivity.vnode_to_cell_csr;
 	const auto& cell_elements = grid.elements.cell_elements;
 	const auto num_cell = cell_elements.size();
 
@@ -224,14 +225,14 @@ auto PostAI::calculate_face_share_cell_indexes_set(const Grid<space_dimension>&
 
 			const auto num_face_vnode = face_vnode_indexes.size();
 
-			const auto& set_0 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[0]);
-			const auto& set_1 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[1]);
+			const auto set_0 = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[0]);
+			const auto set_1 = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[1]);
 			std::set_intersection(set_0.begin(), set_0.end(), set_1.begin(), set_1.end(), std::back_inserter(this_face_share_cell_indexes));
 
 			if (2 < num_face_vnode) {
 				std::vector<size_t> buffer;
 				for (size_t i = 2; i < num_face_vnode; ++i) {
-					const auto& set_i = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[i]);
+					const auto set_i = vnode_to_cell_csr.share_cell_indexes(face_vnode_indexes[i]);
 
 					buffer.clear();
 					std::set_intersection(this_face_share_cell_indexes.begin(), this_face_share_cell_indexes.end(), set_i.begin(), set_i.end(), std::back_inserter(buffer));
@@ -305,4 +306,25 @@ auto PostAI::convert_to_solution_strings(const std::vector<EuclideanVector<num_e
 	return solution_strings;
 }
 
+template <size_t num_equation, size_t space_dimension>
+auto PostAI::convert_to_solution_gradient_strings(const std::vector<Matrix<num_equation, space_dimension>>& solution_gradients) {
+	const auto num_solution = solution_gradients.size();
+
+	std::vector<std::string> solution_gradient_strings;
+	solution_gradient_strings.reserve(num_solution);
+
+	std::string solution_gradient_string;
+	for (size_t i = 0; i < num_solution; ++i) {
+
+		const auto& solution_gradient = solution_gradients[i];
+		for (size_t j = 0; j < num_equation; ++j)
+			for (size_t k = 0; k < space_dimension; ++k)
+				solution_gradient_string += ms::double_to_str_sp(solution_gradient.at(j, k)) + "\t";
+
+		solution_gradient_strings.push_back(std::move(solution_gradient_string));
+	}
+
+	return solution_gradient_strings;
+}
+
 
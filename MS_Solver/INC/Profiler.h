@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <windows.h>	//compile error is occured when windows.h is not includes before psapi.h
@@ -13,6 +14,7 @@ private:
 	static inline PROCESS_MEMORY_COUNTERS_EX memory_recorder_;
 	static inline std::vector<size_t> memory_record_;
 	static inline std::vector<std::chrono::steady_clock::time_point> time_points_;
+	static inline std::atomic<size_t> num_heap_allocation_ = 0;
 
 
 public:
@@ -23,6 +25,9 @@ public:
 	static void print_Consumed_Memory(void);
 	static void record_Consumed_Memory_And_Time(void);
 	static void print_Consumed_Memory_And_Time(void);	
+
+	static void count_heap_allocation(void);
+	static size_t num_heap_allocation(void);	// counted only when COUNT_HEAP_ALLOCATION is defined
 };
 
 
@@ -32,3 +37,4 @@ public:
 #define PRINT_CONSUMED_MEMORY Profiler::print_Consumed_Memory()
 #define RECORD_CONSUMED_MEMORY_AND_TIME Profiler::record_Consumed_Memory_And_Time()
 #define PRINT_CONSUMED_MEMORY_AND_TIME Profiler::print_Consumed_Memory_And_Time()
+#define GET_NUM_HEAP_ALLOCATION Profiler::num_heap_allocation()
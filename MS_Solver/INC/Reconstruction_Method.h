@@ -1,11 +1,16 @@
 #pragma once
+#include <algorithm>
 #include <type_traits>
 #include <string>
 
 #include "Gradient_Method.h"
+#include "Neural_Network.h"
 #include "PostAI.h"
+#include "Slope_Limiter.h"
+#include "Solver_Workspace.h"
 
 class RM {};	// Reconstruction Method
+class MLP_RM : public RM {};	// MLP based Reconstruction Method, limiting values can be frozen
 
 
 class Constant_Reconstruction : public RM 
@@ -26,8 +31,8 @@ private:
     using Solution_Gradient_    = Matrix<num_equation, space_dimension>;
 
 public:
-    const std::vector<Solution_>&   solutions;
-    std::vector<Solution_Gradient_> solution_gradients;
+    const std::vector<Solution_>&           solutions;
+    const std::vector<Solution_Gradient_>&  solution_gradients;
 };
 
 
@@ -38,6 +43,8 @@ private:
     static constexpr size_t num_equation_       = Gradient_Method::num_equation_;
     static constexpr size_t space_dimension_    = Gradient_Method::space_dimension_;
 
+    using Solver_Workspace_ = Solver_Workspace<num_equation_, space_dimension_>;
+
 private:
     Gradient_Method gradient_method;
 
@@ -45,87 +52,132 @@ public:
     Linear_Reconstruction(const Grid<space_dimension_>& grid) : gradient_method(grid) {};
 
 
-    auto reconstruct_solutions(const std::vector<EuclideanVector<num_equation_>>& solutions) const;
+    auto reconstruct_solutions(const std::vector<EuclideanVector<num_equation_>>& solutions, Solver_Workspace_& workspace) const;
 
     static std::string name(void) { return "Linear_Reconstruction_" + Gradient_Method::name(); };
 };
 
 
 
-template <typename Gradient_Method>
-class MLP_Base : public RM
+template <typename Gradient_Method, typename Slope_Limiter>
+class MLP_Base : public MLP_RM
 {
 private:
+    static_require(ms::is_slope_limiter<Slope_Limiter>, "It should be slope limiter");
+
     static constexpr size_t num_equation_       = Gradient_Method::num_equation_;
     static constexpr size_t space_dimension_    = Gradient_Method::space_dimension_;
 
-    using Solution_ = EuclideanVector<num_equation_>;
+    using Solution_         = EuclideanVector<num_equation_>;
+    using Solver_Workspace_ = Solver_Workspace<num_equation_, space_dimension_>;
+    using Space_Array_      = std::array<double, space_dimension_>;
+    using Solution_Array_   = std::array<double, num_equation_>;
+    using Solution_Gradient_= Matrix<num_equation_, space_dimension_>;
 
 protected:
     Gradient_Method gradient_method;
 
-	std::vector<std::vector<size_t>> vnode_indexes_set_;
-	std::vector<Dynamic_Matrix_> center_to_vertex_matrixes_;
-	std::unordered_map<size_t, std::set<size_t>> vnode_index_to_share_cell_indexes_;
+    // vertex nodes are renumbered compactly := vnode number, so vertex data are stored in flat arrays
+    std::vector<size_t> vertex_start_indexes_;              // vertices of cell i := [vertex_start_indexes_[i] ~ vertex_start_indexes_[i + 1])
+    std::vector<size_t> vertex_vnode_numbers_;
+    std::vector<Space_Array_> center_to_vertices_;
+    std::vector<size_t> share_cell_start_indexes_;          // share cells of vnode number n := share_cell_indexes_[share_cell_start_indexes_[n] ~ share_cell_start_indexes_[n + 1])
+    std::vector<size_t> share_cell_indexes_;
+    std::vector<double> epsilon_squares_;
 
 public:
-    auto reconstruct_solutions(const std::vector<Solution_>& solutions) const;
+    auto reconstruct_solutions(const std::vector<Solution_>& solutions, Solver_Workspace_& workspace) const;
 
 protected:
     MLP_Base(Grid<space_dimension_>&& grid);
 
-	auto calculate_vertex_node_index_to_min_max_solution(const std::vector<Solution_>& solutions) const;
-
-    virtual double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution) const abstract;
+    void calculate_vertex_min_max_solutions(const std::vector<Solution_>& solutions, std::vector<Solution_Array_>& vertex_min_solutions, std::vector<Solution_Array_>& vertex_max_solutions) const;
+    Solution_Array_ calculate_limiting_values(const std::vector<Solution_>& solutions, const size_t cell_index, const Solution_Gradient_& solution_gradient, Solver_Workspace_& workspace) const;
+    void calculate_cell_min_max_solution(const size_t cell_index, const Solver_Workspace_& workspace, Solution_Array_& cell_min_solution, Solution_Array_& cell_max_solution) const;
+    void find_troubled_cell_indexes(const double threshold, Solver_Workspace_& workspace) const;
 };
 
 
 template <typename Gradient_Method>
-class MLP_u1 : public MLP_Base<Gradient_Method>
+class MLP_u1 : public MLP_Base<Gradient_Method, MLP_u1_Limiter>
 {
     static constexpr size_t space_dimension_ = Gradient_Method::space_dimension_;
 
 public:
-    MLP_u1(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method>(std::move(grid)) {};
+    MLP_u1(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method, MLP_u1_Limiter>(std::move(grid)) {};
 
     static std::string name(void) { return "MLP_u1_" + Gradient_Method::name(); };
+};
 
-private:
-    double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution) const override;
+
+template <typename Gradient_Method>
+class MLP_u2 : public MLP_Base<Gradient_Method, MLP_u2_Limiter>
+{
+    static constexpr size_t space_dimension_ = Gradient_Method::space_dimension_;
+
+public:
+    MLP_u2(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method, MLP_u2_Limiter>(std::move(grid)) {};
+
+    static std::string name(void) { return "MLP_u2_" + Gradient_Method::name(); };
 };
 
 
 template <typename Gradient_Method>
-class AI_limiter : public RM
+class Barth_Jespersen : public MLP_Base<Gradient_Method, Barth_Jespersen_Limiter>
 {
-private:
-    static constexpr size_t num_equation_ = Gradient_Method::num_equation_;
     static constexpr size_t space_dimension_ = Gradient_Method::space_dimension_;
 
-    using Solution_ = EuclideanVector<num_equation_>;
+public:
+    Barth_Jespersen(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method, Barth_Jespersen_Limiter>(std::move(grid)) {};
+
+    static std::string name(void) { return "Barth_Jespersen_" + Gradient_Method::name(); };
+};
+
+
+template <typename Gradient_Method>
+class Venkatakrishnan : public MLP_Base<Gradient_Method, Venkatakrishnan_Limiter>
+{
+    static constexpr size_t space_dimension_ = Gradient_Method::space_dimension_;
 
-//private: for test
 public:
-    Gradient_Method gradient_method_;
+    Venkatakrishnan(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method, Venkatakrishnan_Limiter>(std::move(grid)) {};
+
+    static std::string name(void) { return "Venkatakrishnan_" + Gradient_Method::name(); };
+};
 
-    size_t num_data_;
-    std::vector<Text> ai_limiter_text_set_;
-    std::vector<std::vector<size_t>> vertex_share_cell_indexes_set_;
-    std::vector<size_t> target_cell_indexes_;
+
+// limiting values of troubled cells are inferred in one batch by trained network, cells in smooth region keep unlimited gradient
+// network input of (troubled cell, equation) := num_feature_ values normalized by vertex neighbor solution range, network output := limiting value
+// RSC/AI/AI_Limiter.bin := reference 5-8-1 network which passes MLP-u1 limiting value through, trained weights of same layout replace it
+template <typename Gradient_Method>
+class AI_limiter : public MLP_Base<Gradient_Method, MLP_u1_Limiter>
+{
+private:
+    static constexpr size_t num_equation_ = Gradient_Method::num_equation_;
+    static constexpr size_t space_dimension_ = Gradient_Method::space_dimension_;
+    static constexpr size_t num_feature_ = 5;
+#ifdef TROUBLED_CELL_THRESHOLD
+    static constexpr double troubled_cell_threshold_ = TROUBLED_CELL_THRESHOLD;
+#else
+    static constexpr double troubled_cell_threshold_ = 0.01;   // AI limiter always infers troubled cells only
+#endif
+
+    using Solution_             = EuclideanVector<num_equation_>;
+    using Solution_Array_       = std::array<double, num_equation_>;
+    using Solution_Gradient_    = Matrix<num_equation_, space_dimension_>;
+    using Solver_Workspace_     = Solver_Workspace<num_equation_, space_dimension_>;
+
+private:
+    Neural_Network neural_network_;
 
 public:
-    AI_limiter(const Grid<space_dimension_>& grid);
+    AI_limiter(Grid<space_dimension_>&& grid);
 
-    auto reconstruct_solutions(const std::vector<Solution_>& solutions);
+    auto reconstruct_solutions(const std::vector<Solution_>& solutions, Solver_Workspace_& workspace) const;
     static std::string name(void) { return "AI_Reconstruction_" + Gradient_Method::name(); };
 
 private:
-    auto calculate_face_share_cell_indexes_set(const Grid<space_dimension_>& grid) const;
-    auto calculate_vertex_nodes_coordinate_string_set(const Grid<space_dimension_>& grid) const;
-    auto convert_to_solution_strings(const std::vector<Solution_>& solutions) const;
-    auto convert_to_solution_gradient_strings(const std::vector<Dynamic_Matrix_>& solution_gradients) const;
-    void record_solution_datas(const std::vector<Solution_>& solutions, const std::vector<Dynamic_Matrix_>& solution_gradients);
-    auto make_ai_limiter_str(void);
+    void calculate_features(const std::vector<Solution_>& solutions, const size_t cell_index, const Solution_Gradient_& solution_gradient, Solver_Workspace_& workspace, double* features) const;
 };
 
 
@@ -136,440 +188,384 @@ namespace ms {
 
     template <typename T>
     inline constexpr bool is_constant_reconstruction = std::is_same_v<Constant_Reconstruction, T>;
+
+    template <typename T>
+    inline constexpr bool is_MLP_reconstruction = std::is_base_of_v<MLP_RM, T>;
 }
 
 
 //template definition part
 template <typename Gradient_Method>
-auto Linear_Reconstruction<Gradient_Method>::reconstruct_solutions(const std::vector<EuclideanVector<num_equation_>>& solutions) const {
-    const auto num_cell = solutions.size();
-    const auto solution_gradients_temp = gradient_method.calculate_solution_gradients(solutions);
-
-    //dynamic matrix to matrix
-    std::vector<Matrix<num_equation_, space_dimension_>> solution_gradients;
-    solution_gradients.reserve(num_cell);
-
-    for (const auto& solution_gradient : solution_gradients_temp)
-        solution_gradients.push_back(solution_gradient);
+auto Linear_Reconstruction<Gradient_Method>::reconstruct_solutions(const std::vector<EuclideanVector<num_equation_>>& solutions, Solver_Workspace_& workspace) const {
+    auto& solution_gradients = workspace.solution_gradients;
+    gradient_method.calculate_solution_gradients(solutions, solution_gradients);
 
     return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, solution_gradients };
 }
 
 
-template <typename Gradient_Method>
-auto MLP_Base<Gradient_Method>::reconstruct_solutions(const std::vector<Solution_>& solutions) const {
-    auto solution_gradients = this->gradient_method.calculate_solution_gradients(solutions);
-    const auto vnode_index_to_min_max_solution = this->calculate_vertex_node_index_to_min_max_solution(solutions);
+template <typename Gradient_Method, typename Slope_Limiter>
+auto MLP_Base<Gradient_Method, Slope_Limiter>::reconstruct_solutions(const std::vector<Solution_>& solutions, Solver_Workspace_& workspace) const {
+    auto& solution_gradients = workspace.solution_gradients;
+
+#ifdef LIMITER_FREEZE_MODE
+    // frozen limiting values are reused, vertex min/max and limiting are skipped
+    workspace.limiting_values.resize(solutions.size());
+    if (workspace.is_limiter_frozen) {
+        this->gradient_method.calculate_solution_gradients(solutions, solution_gradients);
+
+        const auto cell_indexes = std::views::iota(size_t{ 0 }, solutions.size());
+        std::for_each(std::execution::par, cell_indexes.begin(), cell_indexes.end(), [&](const size_t cell_index) {
+            auto& gradient = solution_gradients[cell_index];
+            const auto& limiting_values = workspace.limiting_values[cell_index];
+            for (size_t e = 0; e < num_equation_; ++e)
+                for (size_t d = 0; d < space_dimension_; ++d)
+                    gradient.at(e, d) *= limiting_values[e];
+        });
+
+        return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, solution_gradients };
+    }
+#endif
+
+    this->calculate_vertex_min_max_solutions(solutions, workspace.vertex_min_solutions, workspace.vertex_max_solutions);
+
+#if defined(TROUBLED_CELL_THRESHOLD) && !defined(POST_AI_DATA)
+    // only troubled cells are limited in parallel, gradients of cells in smooth region are used as they are
+    this->gradient_method.calculate_solution_gradients(solutions, solution_gradients);
+    this->find_troubled_cell_indexes(TROUBLED_CELL_THRESHOLD, workspace);
+
+#ifdef LIMITER_FREEZE_MODE
+    for (auto& limiting_values : workspace.limiting_values)
+        limiting_values.fill(1);
+#endif
+
+    const auto& troubled_cell_indexes = workspace.troubled_cell_indexes;
+    std::for_each(std::execution::par, troubled_cell_indexes.begin(), troubled_cell_indexes.end(), [&](const size_t cell_index) {
+        auto& gradient = solution_gradients[cell_index];
+
+        const auto limiting_values = this->calculate_limiting_values(solutions, cell_index, gradient, workspace);
+
+        for (size_t e = 0; e < num_equation_; ++e)
+            for (size_t d = 0; d < space_dimension_; ++d)
+                gradient.at(e, d) *= limiting_values[e];
+    });
+#else
+    // every unlimited gradient is needed before limiting to record AI data
+    this->gradient_method.calculate_solution_gradients(solutions, solution_gradients);
 
     PostAI::record_solution_datas(solutions, solution_gradients);
 
-    const auto num_cell = solutions.size();
-    for (size_t i = 0; i < num_cell; ++i) {
-        auto& gradient = solution_gradients[i];
-        const auto vertex_solution_delta_matrix = gradient * this->center_to_vertex_matrixes_[i];
+#ifdef TROUBLED_CELL_THRESHOLD
+    // only troubled cells are limited, the others record limiting value 1 so every AI data cell has its limiting value
+    this->find_troubled_cell_indexes(TROUBLED_CELL_THRESHOLD, workspace);
 
-        std::array<double, num_equation_> limiting_values;
+#ifdef LIMITER_FREEZE_MODE
+    for (auto& limiting_values : workspace.limiting_values)
         limiting_values.fill(1);
+#endif
 
-        const auto& vnode_indexes = this->vnode_indexes_set_[i];
-        const auto num_vertex = vnode_indexes.size();
+    Solution_Array_ unlimited_values;
+    unlimited_values.fill(1);
 
-        for (size_t j = 0; j < num_vertex; ++j) {
-            const auto vnode_index = vnode_indexes[j];
-            const auto& [min_solution, max_solution] = vnode_index_to_min_max_solution.at(vnode_index);
+    const auto& troubled_cell_indexes = workspace.troubled_cell_indexes;
+    auto troubled_cell_iter = troubled_cell_indexes.begin();
+#endif
 
-            for (size_t e = 0; e < num_equation_; ++e) {
-                const auto limiting_value = this->limit(vertex_solution_delta_matrix.at(e, j), solutions[i].at(e), min_solution.at(e), max_solution.at(e));
-                limiting_values[e] = min(limiting_values[e], limiting_value);
-            }
+    const auto num_cell = solutions.size();
+    for (size_t i = 0; i < num_cell; ++i) {
+        auto& gradient = solution_gradients[i];
+
+#ifdef TROUBLED_CELL_THRESHOLD
+        // troubled cell indexes are in ascending order
+        if (troubled_cell_iter == troubled_cell_indexes.end() || *troubled_cell_iter != i) {
+            PostAI::record_limiting_value(i, unlimited_values);
+            continue;
         }
+        ++troubled_cell_iter;
+#endif
 
+        const auto limiting_values = this->calculate_limiting_values(solutions, i, gradient, workspace);
         PostAI::record_limiting_value(i, limiting_values);
 
-        for (size_t i = 0; i < num_equation_; ++i)
-            for (size_t j = 0; j < space_dimension_; ++j)
-                gradient.at(i, j) *= limiting_values.at(i);
+        for (size_t e = 0; e < num_equation_; ++e)
+            for (size_t d = 0; d < space_dimension_; ++d)
+                gradient.at(e, d) *= limiting_values[e];
     }
 
     PostAI::post();
+#endif
 
-    //dynamic matrix to matrix
-    std::vector<Matrix<num_equation_, space_dimension_>> limited_solution_gradient;
-    limited_solution_gradient.reserve(num_cell);
-
-    for (const auto& solution_gradient : solution_gradients)
-        limited_solution_gradient.push_back(solution_gradient);
-
-    return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, limited_solution_gradient };
+    return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, solution_gradients };
 }
 
-template <typename Gradient_Method>
-MLP_Base<Gradient_Method>::MLP_Base(Grid<space_dimension_>&& grid) : gradient_method(std::move(grid)) {
+template <typename Gradient_Method, typename Slope_Limiter>
+MLP_Base<Gradient_Method, Slope_Limiter>::MLP_Base(Grid<space_dimension_>&& grid) : gradient_method(std::move(grid)) {
     SET_TIME_POINT;
     const auto& cell_elements = grid.elements.cell_elements;
 
     const auto num_cell = cell_elements.size();
-    this->vnode_indexes_set_.reserve(num_cell);
-    this->center_to_vertex_matrixes_.reserve(num_cell);
+    const auto& vnode_to_cell_csr = grid.connectivity.vnode_to_cell_csr;
+
+    //vnode number := compact index of vnode in order of first appearance in cells
+    constexpr auto no_number = (std::numeric_limits<size_t>::max)();
+    std::vector<size_t> vnode_index_to_number(vnode_to_cell_csr.num_vnode(), no_number);
+    size_t num_vnode_number = 0;
 
-    //vnode index to share cell indexes
-    this->vnode_index_to_share_cell_indexes_ = std::move(grid.connectivity.vnode_index_to_share_cell_indexes);
+    this->vertex_start_indexes_.reserve(num_cell + 1);
+    this->vertex_start_indexes_.push_back(0);
+    this->epsilon_squares_.reserve(num_cell);
 
     for (size_t i = 0; i < num_cell; ++i) {
         const auto& element = cell_elements[i];
         const auto& geometry = cell_elements[i].geometry_;
 
-        // vnode indexes set
-        this->vnode_indexes_set_.push_back(element.vertex_node_indexes());
-
-        //center to vertex matrix
-        const auto center_node = geometry.center_node();
+        const auto vnode_indexes = element.vertex_node_indexes();
+        const auto& center_node = grid.geometry.cell_centers[i];
         const auto vertex_nodes = geometry.vertex_nodes();
         const auto num_vertex = vertex_nodes.size();
 
-        Dynamic_Matrix_ center_to_vertex_matrix(space_dimension_, num_vertex);
-        for (size_t i = 0; i < num_vertex; ++i) {
-            const auto center_to_vertex = vertex_nodes[i] - center_node;
-            for (size_t j = 0; j < space_dimension_; ++j)
-                center_to_vertex_matrix.at(j, i) = center_to_vertex[j];
-        }
-        this->center_to_vertex_matrixes_.push_back(std::move(center_to_vertex_matrix));
-    }
-
-    Log::content_ << std::left << std::setw(50) << "@ Construct Cells FVM MLP Base" << " ----------- " << GET_TIME_DURATION << "s\n\n";
-    Log::print();
-}
-
-template <typename Gradient_Method>
-auto MLP_Base<Gradient_Method>::calculate_vertex_node_index_to_min_max_solution(const std::vector<Solution_>& solutions) const {
-    const size_t num_vnode = this->vnode_index_to_share_cell_indexes_.size();
-
-    std::unordered_map<size_t, std::pair<Solution_, Solution_>> vnode_index_to_min_max_solution;
-    vnode_index_to_min_max_solution.reserve(num_vnode);
+        const auto cell_length = std::pow(grid.geometry.cell_volumes[i], 1.0 / space_dimension_);
+        this->epsilon_squares_.push_back(Slope_Limiter::epsilon_square(cell_length));
 
-    for (const auto& [vnode_index, share_cell_indexes] : this->vnode_index_to_share_cell_indexes_) {
-        const size_t num_share_cell = share_cell_indexes.size();
-        std::array<std::vector<double>, num_equation_> equation_wise_solutions;
+        for (size_t j = 0; j < num_vertex; ++j) {
+            auto& vnode_number = vnode_index_to_number[vnode_indexes[j]];
+            if (vnode_number == no_number) {
+                vnode_number = num_vnode_number++;
 
-        for (size_t i = 0; i < num_equation_; ++i)
-            equation_wise_solutions[i].reserve(num_share_cell);
+                const auto share_cell_indexes = vnode_to_cell_csr.share_cell_indexes(vnode_indexes[j]);
+                this->share_cell_indexes_.insert(this->share_cell_indexes_.end(), share_cell_indexes.begin(), share_cell_indexes.end());
+                this->share_cell_start_indexes_.push_back(this->share_cell_indexes_.size());
+            }
 
-        for (const auto cell_index : share_cell_indexes) {
-            for (size_t i = 0; i < num_equation_; ++i)
-                equation_wise_solutions[i].push_back(solutions[cell_index][i]);
-        }
+            const auto center_to_vertex = vertex_nodes[j] - center_node;
+            Space_Array_ center_to_vertex_array;
+            for (size_t d = 0; d < space_dimension_; ++d)
+                center_to_vertex_array[d] = center_to_vertex[d];
 
-        std::array<double, num_equation_> min_solution;
-        std::array<double, num_equation_> max_solution;
-        for (size_t i = 0; i < num_equation_; ++i) {
-            min_solution[i] = *std::min_element(equation_wise_solutions[i].begin(), equation_wise_solutions[i].end());
-            max_solution[i] = *std::max_element(equation_wise_solutions[i].begin(), equation_wise_solutions[i].end());
+            this->vertex_vnode_numbers_.push_back(vnode_number);
+            this->center_to_vertices_.push_back(center_to_vertex_array);
         }
-        Solution_ min_sol = min_solution;
-        Solution_ max_sol = max_solution;
-
-        vnode_index_to_min_max_solution.emplace(vnode_index, std::make_pair(min_sol, max_sol));
+        this->vertex_start_indexes_.push_back(this->vertex_vnode_numbers_.size());
     }
+    this->share_cell_start_indexes_.insert(this->share_cell_start_indexes_.begin(), 0);
 
-    return vnode_index_to_min_max_solution;
+    Log::content_ << std::left << std::setw(50) << "@ Construct Cells FVM MLP Base" << " ----------- " << GET_TIME_DURATION << "s\n\n";
+    Log::print();
 }
 
-
-template <typename Gradient_Method>
-double MLP_u1<Gradient_Method>::limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution) const {
-    if (vertex_solution_delta < 0)
-        return min((min_solution - center_solution) / vertex_solution_delta, 1);
-    else
-        return min((max_solution - center_solution) / vertex_solution_delta, 1);
+template <typename Gradient_Method, typename Slope_Limiter>
+void MLP_Base<Gradient_Method, Slope_Limiter>::calculate_vertex_min_max_solutions(const std::vector<Solution_>& solutions, std::vector<Solution_Array_>& vertex_min_solutions, std::vector<Solution_Array_>& vertex_max_solutions) const {
+    // arrays are sized at the first call only, later calls overwrite values in place
+    const auto num_vnode = this->share_cell_start_indexes_.size() - 1;
+    vertex_min_solutions.resize(num_vnode);
+    vertex_max_solutions.resize(num_vnode);
+
+    const auto vnode_numbers = std::views::iota(size_t{ 0 }, num_vnode);
+    std::for_each(std::execution::par, vnode_numbers.begin(), vnode_numbers.end(), [&](const size_t n) {
+        auto& min_solution = vertex_min_solutions[n];
+        auto& max_solution = vertex_max_solutions[n];
+        min_solution.fill((std::numeric_limits<double>::max)());
+        max_solution.fill(std::numeric_limits<double>::lowest());
+
+        for (size_t j = this->share_cell_start_indexes_[n]; j < this->share_cell_start_indexes_[n + 1]; ++j) {
+            const auto& solution = solutions[this->share_cell_indexes_[j]];
+            for (size_t i = 0; i < num_equation_; ++i) {
+                min_solution[i] = (std::min)(min_solution[i], solution[i]);
+                max_solution[i] = (std::max)(max_solution[i], solution[i]);
+            }
+        }
+    });
 }
 
-template <typename Gradient_Method>
-AI_limiter<Gradient_Method>::AI_limiter(const Grid<space_dimension_>& grid) : gradient_method_(grid) {
-    const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
-    const auto& cell_elements = grid.elements.cell_elements;
-    this->num_data_ = cell_elements.size();
-
-    this->vertex_share_cell_indexes_set_.reserve(this->num_data_);
-    this->ai_limiter_text_set_.resize(this->num_data_);
-    this->target_cell_indexes_.reserve(this->num_data_);
 
-    const auto face_share_cell_indexes_set = this->calculate_face_share_cell_indexes_set(grid);
-    //const auto vnodes_coordinate_string_set = this->calculate_vertex_nodes_coordinate_string_set(grid);
+template <typename Gradient_Method, typename Slope_Limiter>
+MLP_Base<Gradient_Method, Slope_Limiter>::Solution_Array_ MLP_Base<Gradient_Method, Slope_Limiter>::calculate_limiting_values(const std::vector<Solution_>& solutions, const size_t cell_index, const Solution_Gradient_& solution_gradient, Solver_Workspace_& workspace) const {
+    const auto start_index = this->vertex_start_indexes_[cell_index];
+    const auto end_index = this->vertex_start_indexes_[cell_index + 1];
+    const auto center_solution_data = solutions[cell_index].data();
+    const auto epsilon_square = this->epsilon_squares_[cell_index];
 
-    for (size_t i = 0; i < this->num_data_; ++i) {
-        const auto& cell_element = cell_elements[i];
-        const auto& cell_geometry = cell_element.geometry_;
+    Solution_Array_ cell_min_solution, cell_max_solution;
+    if constexpr (!Slope_Limiter::is_vertex_wise_bound_)
+        this->calculate_cell_min_max_solution(cell_index, workspace, cell_min_solution, cell_max_solution);
 
-        //vertex share cell indexes temp
-        std::set<size_t> vertex_share_cell_indexes_temp;
+    Solution_Array_ limiting_values;
+    limiting_values.fill(1);
 
-        const auto vnode_indexes = cell_element.vertex_node_indexes();
-        for (const auto& vnode_index : vnode_indexes) {
-            const auto& vnode_share_cell_indexes = vnode_index_to_share_cell_indexes.at(vnode_index);
-            vertex_share_cell_indexes_temp.insert(vnode_share_cell_indexes.begin(), vnode_share_cell_indexes.end());
-        }
+    for (size_t j = start_index; j < end_index; ++j) {
+        const auto& center_to_vertex = this->center_to_vertices_[j];
 
-        //chunk edge connectivities //quad3  ۵ ʴ algorithm
-        std::set<std::set<size_t>> face_share_cell_index_pairs;
+        const auto vnode_number = this->vertex_vnode_numbers_[j];
+        const auto& min_solution = Slope_Limiter::is_vertex_wise_bound_ ? workspace.vertex_min_solutions[vnode_number] : cell_min_solution;
+        const auto& max_solution = Slope_Limiter::is_vertex_wise_bound_ ? workspace.vertex_max_solutions[vnode_number] : cell_max_solution;
 
-        for (const auto chunk_cell_index : vertex_share_cell_indexes_temp) {
-            const auto& face_share_cell_indexes = face_share_cell_indexes_set.at(chunk_cell_index);
+        for (size_t e = 0; e < num_equation_; ++e) {
+            double vertex_solution_delta = 0.0;
+            for (size_t d = 0; d < space_dimension_; ++d)
+                vertex_solution_delta += solution_gradient.at(e, d) * center_to_vertex[d];
 
-            std::vector<size_t> face_share_cell_indexes_in_chunk;
-            std::set_intersection(vertex_share_cell_indexes_temp.begin(), vertex_share_cell_indexes_temp.end(), face_share_cell_indexes.begin(), face_share_cell_indexes.end(), std::back_inserter(face_share_cell_indexes_in_chunk));
-
-            for (const auto face_share_cell_index_in_chunk : face_share_cell_indexes_in_chunk)
-                face_share_cell_index_pairs.insert({ chunk_cell_index, face_share_cell_index_in_chunk });
+            const auto limiting_value = Slope_Limiter::limit(vertex_solution_delta, center_solution_data[e], min_solution[e], max_solution[e], epsilon_square);
+            limiting_values[e] = (std::min)(limiting_values[e], limiting_value);
         }
+    }
 
-        //vertex_share_cell_indexes
-        vertex_share_cell_indexes_temp.erase(i);
-
-        std::vector<size_t> vertex_share_cell_indexes;
-        vertex_share_cell_indexes.push_back(i);
-        vertex_share_cell_indexes.insert(vertex_share_cell_indexes.end(), vertex_share_cell_indexes_temp.begin(), vertex_share_cell_indexes_temp.end());
-
-        // header string
-        this->ai_limiter_text_set_[i] << "#########################";
-
-        // node number string
-        const auto num_node = vertex_share_cell_indexes.size();
-        this->ai_limiter_text_set_[i] << "@nodeNumber\n" + std::to_string(num_node);
-
-        // node index order string
-        std::string node_index_order_string = "@nodeIndexOrder\n";
-        for (const auto& node_index : vertex_share_cell_indexes)
-            node_index_order_string += std::to_string(node_index) + "\t";
-        this->ai_limiter_text_set_[i] << std::move(node_index_order_string);
+#ifdef LIMITER_FREEZE_MODE
+    workspace.limiting_values[cell_index] = limiting_values;
+#endif
 
-        //edge number string
-        const auto num_edge = face_share_cell_index_pairs.size();
-        this->ai_limiter_text_set_[i] << "@edgeNumber\n" + std::to_string(num_edge);
+    return limiting_values;
+}
 
-        //connectivity string
-        std::string node_connectivity_string = "@connectivity\n";
-        for (const auto& chunk_edge_connectivity : face_share_cell_index_pairs) {
-            for (const auto& node_index : chunk_edge_connectivity)
-                node_connectivity_string += std::to_string(node_index) + "\t";
-            node_connectivity_string += "\n";
+template <typename Gradient_Method, typename Slope_Limiter>
+void MLP_Base<Gradient_Method, Slope_Limiter>::calculate_cell_min_max_solution(const size_t cell_index, const Solver_Workspace_& workspace, Solution_Array_& cell_min_solution, Solution_Array_& cell_max_solution) const {
+    // cell wise bound := bound of whole vertex neighbor stencil
+    const auto start_index = this->vertex_start_indexes_[cell_index];
+    const auto end_index = this->vertex_start_indexes_[cell_index + 1];
+
+    cell_min_solution = workspace.vertex_min_solutions[this->vertex_vnode_numbers_[start_index]];
+    cell_max_solution = workspace.vertex_max_solutions[this->vertex_vnode_numbers_[start_index]];
+    for (size_t j = start_index + 1; j < end_index; ++j) {
+        const auto& min_solution = workspace.vertex_min_solutions[this->vertex_vnode_numbers_[j]];
+        const auto& max_solution = workspace.vertex_max_solutions[this->vertex_vnode_numbers_[j]];
+        for (size_t e = 0; e < num_equation_; ++e) {
+            cell_min_solution[e] = (std::min)(cell_min_solution[e], min_solution[e]);
+            cell_max_solution[e] = (std::max)(cell_max_solution[e], max_solution[e]);
         }
-        node_connectivity_string.pop_back();
-        this->ai_limiter_text_set_[i] << std::move(node_connectivity_string);
-
-        ////cell coords string
-        //std::string cell_coords_string = "@cellCoords\n";
-        //for (const auto vertex_share_cell_index : vertex_share_cell_indexes)
-        //    cell_coords_string += vnodes_coordinate_string_set[vertex_share_cell_index];
-        //cell_coords_string.pop_back();
-
-        //this->ai_limiter_text_set_[i] << std::move(cell_coords_string);
-
-        //vertex_share_cell_indexes
-        this->vertex_share_cell_indexes_set_.push_back(std::move(vertex_share_cell_indexes));
     }
 }
 
-template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::reconstruct_solutions(const std::vector<Solution_>& solutions) {
-    auto solution_gradients = this->gradient_method_.calculate_solution_gradients(solutions);
-
-    this->record_solution_datas(solutions, solution_gradients);
-    auto ai_limiter_str = this->make_ai_limiter_str();
-
-
-    //dynamic matrix to matrix
-    std::vector<Matrix<num_equation_, space_dimension_>> limited_solution_gradient;
-    //limited_solution_gradient.reserve(num_cell);
-
-    for (const auto& solution_gradient : solution_gradients)
-        limited_solution_gradient.push_back(solution_gradient);
-
-    return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, limited_solution_gradient };
-}
-
-template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::calculate_face_share_cell_indexes_set(const Grid<space_dimension_>& grid) const {
-    const auto& vnode_index_to_share_cell_indexes = grid.connectivity.vnode_index_to_share_cell_indexes;
-    const auto& cell_elements = grid.elements.cell_elements;
-    const auto num_cell = cell_elements.size();
-
-    //face share cell indexes set
-    std::vector<std::set<size_t>> face_share_cell_indexes_set;
-    face_share_cell_indexes_set.reserve(num_cell);
+template <typename Gradient_Method, typename Slope_Limiter>
+void MLP_Base<Gradient_Method, Slope_Limiter>::find_troubled_cell_indexes(const double threshold, Solver_Workspace_& workspace) const {
+    // troubled cell := cell whose vertex neighbor solution range exceeds threshold in any equation
+    auto& troubled_cell_indexes = workspace.troubled_cell_indexes;
+    troubled_cell_indexes.clear();
 
+    const auto num_cell = this->vertex_start_indexes_.size() - 1;
+    Solution_Array_ cell_min_solution, cell_max_solution;
     for (size_t i = 0; i < num_cell; ++i) {
-        const auto& element = cell_elements[i];
-        const auto& geometry = cell_elements[i].geometry_;
-
-        const auto face_vnode_indexes_set = element.face_vertex_node_indexes_set();
-        const auto num_face = face_vnode_indexes_set.size();
-
-        std::set<size_t> face_share_cell_indexes;
+        this->calculate_cell_min_max_solution(i, workspace, cell_min_solution, cell_max_solution);
 
-        for (const auto& face_vnode_indexes : face_vnode_indexes_set) {
-            std::vector<size_t> this_face_share_cell_indexes;
-
-            const auto num_face_vnode = face_vnode_indexes.size();
-
-            const auto& set_0 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[0]);
-            const auto& set_1 = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[1]);
-            std::set_intersection(set_0.begin(), set_0.end(), set_1.begin(), set_1.end(), std::back_inserter(this_face_share_cell_indexes));
-
-            if (2 < num_face_vnode) {
-                std::vector<size_t> buffer;
-                for (size_t i = 2; i < num_face_vnode; ++i) {
-                    const auto& set_i = vnode_index_to_share_cell_indexes.at(face_vnode_indexes[i]);
-
-                    buffer.clear();
-                    std::set_intersection(this_face_share_cell_indexes.begin(), this_face_share_cell_indexes.end(), set_i.begin(), set_i.end(), std::back_inserter(buffer));
-                    std::swap(this_face_share_cell_indexes, buffer);
-                }
+        for (size_t e = 0; e < num_equation_; ++e) {
+            if (threshold < cell_max_solution[e] - cell_min_solution[e]) {
+                troubled_cell_indexes.push_back(i);
+                break;
             }
-
-            const auto my_index_pos_iter = std::find(this_face_share_cell_indexes.begin(), this_face_share_cell_indexes.end(), i);
-            dynamic_require(my_index_pos_iter != this_face_share_cell_indexes.end(), "my index should be included in this face share cell indexes");
-
-            this_face_share_cell_indexes.erase(my_index_pos_iter);
-            dynamic_require(this_face_share_cell_indexes.size() == 1, "face share cell should be unique");
-
-            face_share_cell_indexes.insert(this_face_share_cell_indexes.front());
         }
-
-        face_share_cell_indexes_set.push_back(std::move(face_share_cell_indexes));
     }
 
-    return face_share_cell_indexes_set;
+    workspace.num_troubled_cell += troubled_cell_indexes.size();
+    workspace.num_inspected_cell += num_cell;
 }
 
-
 template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::calculate_vertex_nodes_coordinate_string_set(const Grid<space_dimension_>& grid) const {
-    const auto& cell_elements = grid.elements.cell_elements;
-    const auto num_cell = cell_elements.size();
-
-    std::vector<std::string> vnodes_coordinate_string_set;
-    vnodes_coordinate_string_set.reserve(num_cell);
-
-    for (size_t i = 0; i < num_cell; ++i) {
-        const auto& element = cell_elements[i];
-        const auto& geometry = element.geometry_;
-
-        const auto vnodes = geometry.vertex_nodes();
-        const auto num_vnode = vnodes.size();
-        std::string vnodes_coordinate_string = std::to_string(num_vnode) + "\n";
-
-        for (const auto& vnode : vnodes) {
-            for (size_t i = 0; i < space_dimension_; ++i)
-                vnodes_coordinate_string += ms::double_to_str_sp(vnode[i]) + "\t";
-
-            vnodes_coordinate_string += "\n";
-        }
-
-        vnodes_coordinate_string_set.push_back(std::move(vnodes_coordinate_string));
-    }
-
-    return vnodes_coordinate_string_set;
+AI_limiter<Gradient_Method>::AI_limiter(Grid<space_dimension_>&& grid) : MLP_Base<Gradient_Method, MLP_u1_Limiter>(std::move(grid)), neural_network_("RSC/AI/" + std::string(AI_WEIGHT_FILE_NAME) + ".bin") {
+    dynamic_require(this->neural_network_.num_input() == num_feature_, "number of network input should be same with number of AI limiter feature");
+    dynamic_require(this->neural_network_.num_output() == 1, "network should infer one limiting value");
 }
 
-
 template <typename Gradient_Method>
-void AI_limiter<Gradient_Method>::record_solution_datas(const std::vector<Solution_>& solutions, const std::vector<Dynamic_Matrix_>& solution_gradients) {
-    dynamic_require(num_data_ == solutions.size(), "number of solution should be same with number of data");
-    dynamic_require(num_data_ == solution_gradients.size(), "number of solution gradient should be same with number of data");
-
-    const auto solution_strings = this->convert_to_solution_strings(solutions);
-    const auto solution_gradient_strings = this->convert_to_solution_gradient_strings(solution_gradients);
-
-    std::string cell_average_string;
-    std::string cell_gradient_string;
-    for (size_t i = 0; i < num_data_; ++i) {
-        const auto& vertex_share_cell_indexes = vertex_share_cell_indexes_set_[i];
-        const auto num_vertex_share_cell = vertex_share_cell_indexes.size();
-
-
-        std::vector<double> vertex_share_cell_solutions(num_vertex_share_cell);
-        for (size_t i = 0; i < num_vertex_share_cell; ++i)
-            vertex_share_cell_solutions[i] = solutions[vertex_share_cell_indexes[i]][0];
-
-        const auto min_solution = *std::min_element(vertex_share_cell_solutions.begin(), vertex_share_cell_solutions.end());
-        const auto max_solution = *std::max_element(vertex_share_cell_solutions.begin(), vertex_share_cell_solutions.end());
-        const auto solution_diff = max_solution - min_solution;
-
-        if (solution_diff < 0.01)
-            continue;
-
-        this->target_cell_indexes_.push_back(i);
-
-        cell_average_string = "@cellAverage\n";
-        cell_gradient_string = "@cellGradient\n";
-        for (const auto vertex_share_cell_index : vertex_share_cell_indexes) {
-            cell_average_string += solution_strings[vertex_share_cell_index] + "\n";
-            cell_gradient_string += solution_gradient_strings[vertex_share_cell_index] + "\n";
+auto AI_limiter<Gradient_Method>::reconstruct_solutions(const std::vector<Solution_>& solutions, Solver_Workspace_& workspace) const {
+#ifdef LIMITER_FREEZE_MODE
+    // frozen limiting values are applied by MLP_Base as they are
+    if (workspace.is_limiter_frozen)
+        return MLP_Base<Gradient_Method, MLP_u1_Limiter>::reconstruct_solutions(solutions, workspace);
+
+    workspace.limiting_values.resize(solutions.size());
+    for (auto& limiting_values : workspace.limiting_values)
+        limiting_values.fill(1);
+#endif
+
+    auto& solution_gradients = workspace.solution_gradients;
+    this->gradient_method.calculate_solution_gradients(solutions, solution_gradients);
+
+    this->calculate_vertex_min_max_solutions(solutions, workspace.vertex_min_solutions, workspace.vertex_max_solutions);
+    this->find_troubled_cell_indexes(troubled_cell_threshold_, workspace);
+
+    const auto& troubled_cell_indexes = workspace.troubled_cell_indexes;
+    const auto num_troubled_cell = troubled_cell_indexes.size();
+    if (num_troubled_cell == 0)
+        return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, solution_gradients };
+
+    // features[(k * num_equation_ + e) * num_feature_ + f] := feature f of equation e of k-th troubled cell, buffers only grow
+    const auto num_row = num_troubled_cell * num_equation_;
+    auto& features = workspace.ai_features;
+    auto& ai_limiting_values = workspace.ai_limiting_values;
+    features.resize(num_row * num_feature_);
+    ai_limiting_values.resize(num_row);
+
+    const auto troubled_orders = std::views::iota(size_t{ 0 }, num_troubled_cell);
+    std::for_each(std::execution::par, troubled_orders.begin(), troubled_orders.end(), [&](const size_t k) {
+        const auto cell_index = troubled_cell_indexes[k];
+        this->calculate_features(solutions, cell_index, solution_gradients[cell_index], workspace, features.data() + k * num_equation_ * num_feature_);
+    });
+
+    this->neural_network_.infer(features.data(), num_row, ai_limiting_values.data(), workspace.network_layer_outputs);
+
+    std::for_each(std::execution::par, troubled_orders.begin(), troubled_orders.end(), [&](const size_t k) {
+        const auto cell_index = troubled_cell_indexes[k];
+        const auto cell_features = features.data() + k * num_equation_ * num_feature_;
+        auto& gradient = solution_gradients[cell_index];
+
+        for (size_t e = 0; e < num_equation_; ++e) {
+            // equation in smooth region is marked by zero features and keeps unlimited gradient
+            const auto is_smooth = cell_features[e * num_feature_] == 0.0 && cell_features[e * num_feature_ + 1] == 0.0;
+            const auto ai_limiting_value = ai_limiting_values[k * num_equation_ + e];
+            const auto limiting_value = is_smooth ? 1.0 : (std::min)((std::max)(ai_limiting_value, 0.0), 1.0);
+
+            for (size_t d = 0; d < space_dimension_; ++d)
+                gradient.at(e, d) *= limiting_value;
+
+#ifdef LIMITER_FREEZE_MODE
+            workspace.limiting_values[cell_index][e] = limiting_value;
+#endif
         }
-        cell_average_string.pop_back();
-        cell_gradient_string.pop_back();
+    });
 
-        this->ai_limiter_text_set_[i] << std::move(cell_average_string) << std::move(cell_gradient_string);
-    }
+    return Linear_Reconstructed_Solution<num_equation_, space_dimension_>{ solutions, solution_gradients };
 }
 
 template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::convert_to_solution_strings(const std::vector<Solution_>& solutions) const {
-    const auto num_solution = solutions.size();
-
-    std::vector<std::string> solution_strings;
-    solution_strings.reserve(num_solution);
-
-    std::string solution_string;
-    for (size_t i = 0; i < num_solution; ++i) {
-
-        const auto& solution = solutions[i];
-        for (size_t j = 0; j < num_equation_; ++j)
-            solution_string += ms::double_to_str_sp(solution[j]) + "\t";
-
-        solution_strings.push_back(std::move(solution_string));
-    }
-
-    return solution_strings;
-}
+void AI_limiter<Gradient_Method>::calculate_features(const std::vector<Solution_>& solutions, const size_t cell_index, const Solution_Gradient_& solution_gradient, Solver_Workspace_& workspace, double* features) const {
+    // features of equation := (max bound, min bound, max vertex delta, min vertex delta) relative to center and normalized by solution range, MLP-u1 limiting value
+    const auto start_index = this->vertex_start_indexes_[cell_index];
+    const auto end_index = this->vertex_start_indexes_[cell_index + 1];
+    const auto& center_solution = solutions[cell_index];
 
-template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::convert_to_solution_gradient_strings(const std::vector<Dynamic_Matrix_>& solution_gradients) const {
-    const auto num_solution = solution_gradients.size();
-    const auto [num_equation, space_dimension] = solution_gradients.front().size();
+    Solution_Array_ cell_min_solution, cell_max_solution;
+    this->calculate_cell_min_max_solution(cell_index, workspace, cell_min_solution, cell_max_solution);
 
-    std::vector<std::string> solution_gradient_strings;
-    solution_gradient_strings.reserve(num_solution);
+    Solution_Array_ max_vertex_solution_deltas, min_vertex_solution_deltas;
+    max_vertex_solution_deltas.fill(std::numeric_limits<double>::lowest());
+    min_vertex_solution_deltas.fill((std::numeric_limits<double>::max)());
 
-    std::string solution_gradient_string;
-    for (size_t i = 0; i < num_solution; ++i) {
+    for (size_t j = start_index; j < end_index; ++j) {
+        const auto& center_to_vertex = this->center_to_vertices_[j];
 
-        const auto& solution_gradient = solution_gradients[i];
-        for (size_t j = 0; j < num_equation; ++j)
-            for (size_t k = 0; k < space_dimension; ++k)
-                solution_gradient_string += ms::double_to_str_sp(solution_gradient.at(j, k)) + "\t";
+        for (size_t e = 0; e < num_equation_; ++e) {
+            double vertex_solution_delta = 0.0;
+            for (size_t d = 0; d < space_dimension_; ++d)
+                vertex_solution_delta += solution_gradient.at(e, d) * center_to_vertex[d];
 
-        solution_gradient_strings.push_back(std::move(solution_gradient_string));
+            max_vertex_solution_deltas[e] = (std::max)(max_vertex_solution_deltas[e], vertex_solution_delta);
+            min_vertex_solution_deltas[e] = (std::min)(min_vertex_solution_deltas[e], vertex_solution_delta);
+        }
     }
 
-    return solution_gradient_strings;
-}
-
-template <typename Gradient_Method>
-auto AI_limiter<Gradient_Method>::make_ai_limiter_str(void) {
-    std::string ai_limiter_str;
+    const auto mlp_limiting_values = this->calculate_limiting_values(solutions, cell_index, solution_gradient, workspace);
 
-    constexpr size_t num_solution_str = 2;
-    for (const auto target_cell_index : this->target_cell_indexes_) {
-        auto& ai_limiter_text = this->ai_limiter_text_set_.at(target_cell_index);
+    for (size_t e = 0; e < num_equation_; ++e) {
+        auto equation_features = features + e * num_feature_;
 
-        for (const auto& str : ai_limiter_text)
-            ai_limiter_str += str + "\n";
+        const auto solution_range = cell_max_solution[e] - cell_min_solution[e];
+        if (solution_range <= troubled_cell_threshold_) {
+            std::fill(equation_features, equation_features + num_feature_, 0.0);
+            continue;
+        }
 
-        ai_limiter_text.erase(ai_limiter_text.end() - num_solution_str, ai_limiter_text.end());
+        equation_features[0] = (cell_max_solution[e] - center_solution[e]) / solution_range;
+        equation_features[1] = (cell_min_solution[e] - center_solution[e]) / solution_range;
+        equation_features[2] = max_vertex_solution_deltas[e] / solution_range;
+        equation_features[3] = min_vertex_solution_deltas[e] / solution_range;
+        equation_features[4] = mlp_limiting_values[e];
     }
-
-    this->target_cell_indexes_.clear();
-
-    return ai_limiter_str;
 }
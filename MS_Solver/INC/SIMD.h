@@ -0,0 +1,37 @@
+#pragma once
+#include <immintrin.h>
+
+// packed double operations of the widest instruction set enabled for the target (AVX-512, AVX2, or none)
+#if defined(__AVX512F__)
+using Packed_Double_ = __m512d;
+inline constexpr size_t simd_width = 8;
+#define SIMD_LOAD(ptr)			_mm512_loadu_pd(ptr)
+#define SIMD_STORE(ptr, x)		_mm512_storeu_pd(ptr, x)
+#define SIMD_SET(x)				_mm512_set1_pd(x)
+#define SIMD_ADD(x, y)			_mm512_add_pd(x, y)
+#define SIMD_SUB(x, y)			_mm512_sub_pd(x, y)
+#define SIMD_MUL(x, y)			_mm512_mul_pd(x, y)
+#define SIMD_DIV(x, y)			_mm512_div_pd(x, y)
+#define SIMD_SQRT(x)			_mm512_sqrt_pd(x)
+#define SIMD_MAX(x, y)			_mm512_max_pd(x, y)
+#define SIMD_ABS(x)				_mm512_abs_pd(x)
+#elif defined(__AVX2__) || defined(__AVX__)
+using Packed_Double_ = __m256d;
+inline constexpr size_t simd_width = 4;
+#define SIMD_LOAD(ptr)			_mm256_loadu_pd(ptr)
+#define SIMD_STORE(ptr, x)		_mm256_storeu_pd(ptr, x)
+#define SIMD_SET(x)				_mm256_set1_pd(x)
+#define SIMD_ADD(x, y)			_mm256_add_pd(x, y)
+#define SIMD_SUB(x, y)			_mm256_sub_pd(x, y)
+#define SIMD_MUL(x, y)			_mm256_mul_pd(x, y)
+#define SIMD_DIV(x, y)			_mm256_div_pd(x, y)
+#define SIMD_SQRT(x)			_mm256_sqrt_pd(x)
+#define SIMD_MAX(x, y)			_mm256_max_pd(x, y)
+#define SIMD_ABS(x)				_mm256_andnot_pd(_mm256_set1_pd(-0.0), x)
+#else
+inline constexpr size_t simd_width = 1;
+#endif
+
+// SIMD kernels keep the operation order of the scalar expression and never fuse multiply add,
+// so the packed and scalar paths give bitwise identical results
+// (as long as the compiler does not contract the scalar expression either, e.g. MSVC default or -ffp-contract=off)
\ No newline at end of file
@@ -23,17 +23,20 @@ class Semi_Discrete_Equation
 
     using Solution_             = typename Governing_Equation::Solution_;
     using Boundary_Flux_             = EuclideanVector<num_equation_>;
+    using Solver_Workspace_     = Solver_Workspace<num_equation_, space_dimension_>;
 
 private:
+    Reconstruction_Method reconstruction_method_;  // constructed first, since face methods move their connectivity out of grid
     Boundaries_ boundaries_;
     Cells_ cells_;
     Periodic_Boundaries_ periodic_boundaries_;
     Inner_Faces_ inner_faces_;
-    Reconstruction_Method reconstruction_method_;
+    mutable Solver_Workspace_ workspace_;
 
 public:
     Semi_Discrete_Equation(Grid<space_dimension_>&& grid)
-        : boundaries_(std::move(grid)), cells_(grid), periodic_boundaries_(std::move(grid)), inner_faces_(std::move(grid)), reconstruction_method_(std::move(grid)) {
+        : reconstruction_method_(std::move(grid)), boundaries_(std::move(grid)), cells_(grid), periodic_boundaries_(std::move(grid)), inner_faces_(std::move(grid)),
+        workspace_(grid.elements.cell_elements.size(), (std::max)({ grid.elements.inner_face_elements.size(), grid.elements.boundary_elements.size(), grid.elements.periodic_boundary_element_pairs.size() })) {
 
         Log::content_ << "================================================================================\n";
         Log::content_ << "\t\t\t Total ellapsed time: " << GET_TIME_DURATION << "s\n";
@@ -45,34 +48,66 @@ public:
     double calculate_time_step(const std::vector<Solution_>& solutions) const {
         static constexpr double time_step_constant_ = Time_Step_Method::constant();
         if constexpr (std::is_same_v<Time_Step_Method, CFL<time_step_constant_>>) {
-            const auto projected_maximum_lambdas = Governing_Equation::coordinate_projected_maximum_lambdas(solutions);
-            return this->cells_.calculate_time_step(projected_maximum_lambdas, time_step_constant_);
+            if constexpr (std::is_same_v<Governing_Equation, Euler_2D>) {
+                // primitive variables for first stage RHS are converted in same pass
+                auto& primitive_variables = this->workspace_.primitive_variables;
+                const auto calculate_coordinate_projected_maximum_lambda = [&](const size_t i) {
+                    primitive_variables[i] = Governing_Equation::conservative_to_primitive(solutions[i]);
+                    return Governing_Equation::coordinate_projected_maximum_lambda(primitive_variables[i]);
+                };
+
+                const auto time_step = this->cells_.calculate_time_step(calculate_coordinate_projected_maximum_lambda, time_step_constant_);
+                this->workspace_.is_primitive_variables_reusable = true;
+                return time_step;
+            }
+            else {
+                const auto calculate_coordinate_projected_maximum_lambda = [&](const size_t i) {
+                    return Governing_Equation::coordinate_projected_maximum_lambda(solutions[i]);
+                };
+                return this->cells_.calculate_time_step(calculate_coordinate_projected_maximum_lambda, time_step_constant_);
+            }
         }
         else
             return time_step_constant_;
     }
 
-    std::vector<Boundary_Flux_> calculate_RHS(const std::vector<Solution_>& solutions) const {
-        static const auto num_solution = solutions.size();
-        std::vector<Boundary_Flux_> RHS(num_solution);
+    const std::vector<Boundary_Flux_>& calculate_RHS(const std::vector<Solution_>& solutions) const {
+        auto& RHS = this->workspace_.RHS;
+        std::fill(RHS.begin(), RHS.end(), Boundary_Flux_());
+
+        if constexpr (std::is_same_v<Governing_Equation, Euler_2D>) {
+            if (!this->workspace_.is_primitive_variables_reusable)
+                this->update_primitive_variables(solutions);
+
+            this->workspace_.is_primitive_variables_reusable = false;
+        }
 
         if constexpr (ms::is_constant_reconstruction<Reconstruction_Method>) {
-            this->boundaries_.calculate_RHS(RHS, solutions);
-            this->periodic_boundaries_.calculate_RHS<Numerical_Flux_Function>(RHS, solutions);
-            this->inner_faces_.calculate_RHS<Numerical_Flux_Function>(RHS, solutions);
+            this->boundaries_.calculate_RHS(this->workspace_, solutions);
+            this->periodic_boundaries_.calculate_RHS<Numerical_Flux_Function>(this->workspace_, solutions);
+            this->inner_faces_.calculate_RHS<Numerical_Flux_Function>(this->workspace_, solutions);
             this->cells_.scale_RHS(RHS);            
         }
         else{
-            const auto reconstructed_solutions = this->reconstruction_method_.reconstruct_solutions(solutions);
-            this->boundaries_.calculate_RHS(RHS, reconstructed_solutions);
-            this->periodic_boundaries_.calculate_RHS<Numerical_Flux_Function, num_equation_>(RHS, reconstructed_solutions);
-            this->inner_faces_.calculate_RHS<Numerical_Flux_Function, num_equation_>(RHS, reconstructed_solutions);
+            const auto reconstructed_solutions = this->reconstruction_method_.reconstruct_solutions(solutions, this->workspace_);
+            this->boundaries_.calculate_RHS(this->workspace_, reconstructed_solutions);
+            this->periodic_boundaries_.calculate_RHS<Numerical_Flux_Function, num_equation_>(this->workspace_, reconstructed_solutions);
+            this->inner_faces_.calculate_RHS<Numerical_Flux_Function, num_equation_>(this->workspace_, reconstructed_solutions);
             this->cells_.scale_RHS(RHS);
         }
 
         return RHS;
     }
 
+    Solver_Workspace_& workspace(void) const {
+        return this->workspace_;
+    }
+
+    static constexpr bool is_limiter_freezable(void) {
+        return ms::is_MLP_reconstruction<Reconstruction_Method>;
+    }
+
+
     template <typename Initial_Condition>
     std::vector<Solution_> calculate_initial_solutions(void)const {
         return cells_.calculate_initial_solutions<Initial_Condition>();
@@ -83,4 +118,8 @@ public:
         cells_.estimate_error<Initial_Condition, Governing_Equation>(computed_solution, time);
     }
 
+private:
+    void update_primitive_variables(const std::vector<Solution_>& solutions) const {
+        Governing_Equation::conservative_to_primitive(solutions, this->workspace_.primitive_variables);
+    }
 };
\ No newline at end of file
@@ -2,12 +2,14 @@
 #define DIMENSION						2
 #define GRID_FILE_TYPE					Gmsh
 #define GRID_FILE_NAME					"Quad30"
+#define CELL_ORDERING					Original_Order
 #define GOVERNING_EQUATION_NAME			Linear_Advection
 #define INITIAL_CONDITION_NAME			Square_Wave
 #define SPATIAL_DISCRETE_METHOD			FVM
 #define RECONSTRUCTION_ORDER			1
 #define RECONSTRUCTION_TYPE				MLP_u1
 #define GRADIENT_METHOD					Vertex_Least_Square
+#define AI_WEIGHT_FILE_NAME				"AI_Limiter"
 #define NUMERICAL_FLUX_NAME				LLF
 #define TIME_INTEGRAL_METHOD			SSPRK33
 #define TIME_STEP_METHOD_NAME			CFL
@@ -20,20 +22,27 @@
 
 //mode 
 #define POST_AI_DATA
+//#define RHS_GATHER_MODE				// cell gather form residual assembly instead of face scatter form
+//#define TROUBLED_CELL_THRESHOLD		0.01			// MLP limits only cells whose vertex neighbor solution range exceeds threshold, also used by AI_limiter (0.01 if not defined)
+//#define LIMITER_FREEZE_ITERATION		1000			// MLP limiting values are frozen after this number of update (steady state)
+//#define LIMITER_FREEZE_RESIDUAL_DROP	1.0E-3			// MLP limiting values are frozen when residual drops by this ratio from first update (steady state)
+//#define COUNT_HEAP_ALLOCATION			// log number of heap allocation per time step, zero after first step except post steps (turn off POST_AI_DATA, which allocates to record)
 
 //Availiable List
 
 //DIMENSION							2
 //GRID_FILE_TYPE					Gmsh
 //GRID_FILE_NAME					"-"
+//CELL_ORDERING						Original_Order, Reverse_Cuthill_McKee, Hilbert_Curve
 //GOVERNING_EQUATION_NAME			Linear_Advection, Burgers, Euler
 //INITIAL_CONDITION_NAME			Sine_Wave, Square_Wave, Modifid_SOD
 //SPATIAL_DISCRETE_METHOD			FVM
 //RECONSTRUCTION_ORDER				0,1 (For FVM)
-//RECONSTRUCTION_TYPE				Linear_Reconstruction, MLP_u1, AI			# will be ignored when reconstruction order is 0
-//GRADIENT_METHOD					Vertex_Least_Square, Face_Least_Square		# will be ignored when reconstruction order is 0
+//RECONSTRUCTION_TYPE				Linear_Reconstruction, MLP_u1, MLP_u2, Barth_Jespersen, Venkatakrishnan, AI_limiter			# will be ignored when reconstruction order is 0
+//GRADIENT_METHOD					Vertex_Least_Square, Face_Least_Square, Green_Gauss		# will be ignored when reconstruction order is 0
+//AI_WEIGHT_FILE_NAME				"-"									# network weight file in RSC/AI/, will be ignored when reconstruction type is not AI
 //NUMERICAL_FLUX_NAME				LLF
-//TIME_INTGRAL_METHOD				SSPRK33
+//TIME_INTGRAL_METHOD				SSPRK33, SSPRK54, Williamson_RK3, Carpenter_Kennedy_RK4
 //TIME_STEP_METHOD_NAME				CFL, ConstDt
 //TIME_STEP_CONSTNAT				-
 //END_CONDITION_NAME				Time, Iter
@@ -68,3 +77,7 @@
 	#define RECONSTRUCTION_METHOD	RECONSTRUCTION_TYPE<GRADIENT_METHOD<GOVERNING_EQUATION::num_equation(), DIMENSION>>
 #endif
 
+#if defined(LIMITER_FREEZE_ITERATION) || defined(LIMITER_FREEZE_RESIDUAL_DROP)
+	#define LIMITER_FREEZE_MODE
+#endif
+
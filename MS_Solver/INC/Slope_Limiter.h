@@ -0,0 +1,124 @@
+#pragma once
+#include <type_traits>
+#include <string>
+
+
+class SL {};	// Slope Limiter
+
+
+// every slope limiter provides static inline limit, so limiting loop can be inlined and vectorized
+// vertex_solution_delta := gradient extrapolated from cell center to vertex
+// min/max_solution := solution bound of vertex share cells (vertex wise bound) or of whole vertex neighbor stencil (cell wise bound)
+class MLP_u1_Limiter : public SL
+{
+public:
+	static constexpr bool is_vertex_wise_bound_ = true;
+
+	static double epsilon_square(const double cell_length) { return 0.0; };
+	static double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square);
+
+	static std::string name(void) { return "MLP_u1"; };
+};
+
+
+class MLP_u2_Limiter : public SL
+{
+public:
+	static constexpr bool is_vertex_wise_bound_ = true;
+
+	static double epsilon_square(const double cell_length);
+	static double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square);
+
+	static std::string name(void) { return "MLP_u2"; };
+
+private:
+	static constexpr double K_ = 5.0;
+};
+
+
+class Barth_Jespersen_Limiter : public SL
+{
+public:
+	static constexpr bool is_vertex_wise_bound_ = false;
+
+	static double epsilon_square(const double cell_length) { return 0.0; };
+	static double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square);
+
+	static std::string name(void) { return "Barth_Jespersen"; };
+};
+
+
+class Venkatakrishnan_Limiter : public SL
+{
+public:
+	static constexpr bool is_vertex_wise_bound_ = false;
+
+	static double epsilon_square(const double cell_length);
+	static double limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square);
+
+	static std::string name(void) { return "Venkatakrishnan"; };
+
+private:
+	static constexpr double K_ = 5.0;
+};
+
+
+namespace ms {
+	template <typename T>
+	inline constexpr bool is_slope_limiter = std::is_base_of_v<SL, T>;
+
+	double unsmooth_limiting_function(const double delta_plus, const double delta_minus);								// min(delta_plus / delta_minus, 1)
+	double smooth_limiting_function(const double delta_plus, const double delta_minus, const double epsilon_square);	// Venkatakrishnan function
+}
+
+
+//inline definition part
+namespace ms {
+	inline double unsmooth_limiting_function(const double delta_plus, const double delta_minus) {
+		// delta_minus == 0 gives nan or inf, both become 1
+		const auto ratio = delta_plus / delta_minus;
+		return ratio < 1.0 ? ratio : 1.0;
+	}
+
+	inline double smooth_limiting_function(const double delta_plus, const double delta_minus, const double epsilon_square) {
+		if (delta_minus == 0.0)
+			return 1.0;
+
+		const auto delta_plus_square = delta_plus * delta_plus;
+		const auto delta_minus_square = delta_minus * delta_minus;
+
+		const auto numerator = (delta_plus_square + epsilon_square) * delta_minus + 2.0 * delta_minus_square * delta_plus;
+		const auto denominator = delta_plus_square + 2.0 * delta_minus_square + delta_plus * delta_minus + epsilon_square;
+		return numerator / (denominator * delta_minus);
+	}
+}
+
+inline double MLP_u1_Limiter::limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square) {
+	const auto bound_solution = vertex_solution_delta < 0 ? min_solution : max_solution;
+	return ms::unsmooth_limiting_function(bound_solution - center_solution, vertex_solution_delta);
+}
+
+inline double MLP_u2_Limiter::epsilon_square(const double cell_length) {
+	const auto K_length = K_ * cell_length;
+	return K_length * K_length * K_length;
+}
+
+inline double MLP_u2_Limiter::limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square) {
+	const auto bound_solution = vertex_solution_delta < 0 ? min_solution : max_solution;
+	return ms::smooth_limiting_function(bound_solution - center_solution, vertex_solution_delta, epsilon_square);
+}
+
+inline double Barth_Jespersen_Limiter::limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square) {
+	const auto bound_solution = vertex_solution_delta < 0 ? min_solution : max_solution;
+	return ms::unsmooth_limiting_function(bound_solution - center_solution, vertex_solution_delta);
+}
+
+inline double Venkatakrishnan_Limiter::epsilon_square(const double cell_length) {
+	const auto K_length = K_ * cell_length;
+	return K_length * K_length * K_length;
+}
+
+inline double Venkatakrishnan_Limiter::limit(const double vertex_solution_delta, const double center_solution, const double min_solution, const double max_solution, const double epsilon_square) {
+	const auto bound_solution = vertex_solution_delta < 0 ? min_solution : max_solution;
+	return ms::smooth_limiting_function(bound_solution - center_solution, vertex_solution_delta, epsilon_square);
+}
\ No newline at end of file
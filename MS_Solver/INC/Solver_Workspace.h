@@ -0,0 +1,52 @@
+#pragma once
+#include "Matrix.h"
+
+
+// buffers sized once at construction and reused by every RHS evaluation and time integral stage
+template <size_t num_equation, size_t space_dimension>
+struct Solver_Workspace
+{
+private:
+    using Solution_             = EuclideanVector<num_equation>;
+    using Solution_Gradient_    = Matrix<num_equation, space_dimension>;
+    using Physical_Flux_        = Matrix<num_equation, space_dimension>;
+
+public:
+    Solver_Workspace(void) = default;
+    Solver_Workspace(const size_t num_cell, const size_t max_num_face);
+
+public:
+    std::vector<Solution_>                                          RHS;
+    std::vector<Solution_>                                          face_fluxes;                // reused by each face group
+    std::vector<Solution_>                                          primitive_variables;        // updated once per stage
+    bool                                                            is_primitive_variables_reusable = false;  // primitive variables already correspond to solutions of next RHS evaluation
+    std::vector<Physical_Flux_>                                     physical_fluxes;
+    std::vector<Solution_Gradient_>                                 solution_gradients;
+    std::vector<std::array<double, num_equation>>                   vertex_min_solutions;       // indexed by compact vnode number
+    std::vector<std::array<double, num_equation>>                   vertex_max_solutions;
+    std::vector<size_t>                                             troubled_cell_indexes;      // cells which need limiting in current stage
+    size_t                                                          num_troubled_cell = 0;      // accumulated over stages until logged
+    size_t                                                          num_inspected_cell = 0;
+    std::vector<std::array<double, num_equation>>                   limiting_values;            // recorded while limiter is not frozen
+    bool                                                            is_limiter_frozen = false;
+    std::vector<double>                                             ai_features;                // AI limiter network input of troubled cells, only grows
+    std::vector<double>                                             ai_limiting_values;         // AI limiter network output of troubled cells, only grows
+    std::array<std::vector<double>, 2>                              network_layer_outputs;      // intermediate layer outputs of AI limiter network
+
+    // time integral registers are sized at first time step by methods which use them
+    std::vector<Solution_>                                          solution_increments;        // second register of 2N storage Runge-Kutta
+    std::vector<Solution_>                                          initial_solutions;          // solutions at start of time step, second register of 2S* storage Runge-Kutta
+    std::vector<Solution_>                                          auxiliary_solutions;        // extra register of time integral methods which need one
+};
+
+
+//template definition part
+template <size_t num_equation, size_t space_dimension>
+Solver_Workspace<num_equation, space_dimension>::Solver_Workspace(const size_t num_cell, const size_t max_num_face) {
+    this->RHS.resize(num_cell);
+    this->face_fluxes.resize(max_num_face);
+    this->primitive_variables.resize(num_cell);
+    this->physical_fluxes.resize(num_cell);
+    this->solution_gradients.resize(num_cell);
+    this->troubled_cell_indexes.reserve(num_cell);
+}
@@ -1,36 +1,147 @@
 #pragma once
+#include <array>
 #include <vector>
 
 class TIM {};
 
 
-class SSPRK33 : public TIM {
+// Spiteri & Ruuth SSPRK(5,4), Shu-Osher form
+// SSP coefficient 1.508 allows larger CFL than SSPRK33 for same cost per stage
+// besides solutions, needs initial solutions and partial sums of stage5 terms as registers
+class SSPRK54 : public TIM {
 public:
     template <typename Semi_Discrete_Eq, typename Solution>
     static void update_solutions(const Semi_Discrete_Eq& semi_discrete_equation, std::vector<Solution>& solutions, const double time_step) {
-        static const auto num_sol = solutions.size();
-        const auto initial_solutions = solutions;
+        auto& workspace = semi_discrete_equation.workspace();
+        auto& initial_solutions = workspace.initial_solutions;
+        auto& partial_sums = workspace.auxiliary_solutions;    // accumulate stage5 terms of u2, u3
+        const auto num_solution = solutions.size();
+        initial_solutions.resize(num_solution);                 // registers are allocated at first time step only
+        partial_sums.resize(num_solution);
 
         //stage1
-        const auto initial_RHS = semi_discrete_equation.calculate_RHS(initial_solutions);
-        for (size_t i = 0; i < num_sol; ++i)
-            solutions[i] += time_step * initial_RHS[i];
+        const auto& initial_RHS = semi_discrete_equation.calculate_RHS(solutions);
+        for (size_t i = 0; i < num_solution; ++i) {
+            initial_solutions[i] = solutions[i];
+            solutions[i] += 0.391752226571890 * time_step * initial_RHS[i];
+        }
 
-        //stage 2
-        const auto stage1_RHS = semi_discrete_equation.calculate_RHS(solutions);
-        for (size_t i = 0; i < num_sol; ++i)
-            solutions[i] = 0.25 * (3 * initial_solutions[i] + solutions[i] + time_step * stage1_RHS[i]);
+        //stage2
+        const auto& stage1_RHS = semi_discrete_equation.calculate_RHS(solutions);
+        for (size_t i = 0; i < num_solution; ++i) {
+            solutions[i] = 0.444370493651235 * initial_solutions[i] + 0.555629506348765 * solutions[i] + 0.368410593050371 * time_step * stage1_RHS[i];
+            partial_sums[i] = solutions[i];
+        }
 
         //stage3
-        const auto stage2_RHS = semi_discrete_equation.calculate_RHS(solutions);
-        for (size_t i = 0; i < num_sol; ++i)
-            solutions[i] = c3_ * (initial_solutions[i] + 2 * solutions[i] + 2 * time_step * stage2_RHS[i]);
+        const auto& stage2_RHS = semi_discrete_equation.calculate_RHS(solutions);
+        for (size_t i = 0; i < num_solution; ++i)
+            solutions[i] = 0.620101851488403 * initial_solutions[i] + 0.379898148511597 * solutions[i] + 0.251891774271694 * time_step * stage2_RHS[i];
+
+        //stage4
+        const auto& stage3_RHS = semi_discrete_equation.calculate_RHS(solutions);
+        for (size_t i = 0; i < num_solution; ++i) {
+            partial_sums[i] = 0.517231671970585 * partial_sums[i] + 0.096059710526147 * solutions[i] + 0.063692468666290 * time_step * stage3_RHS[i];
+            solutions[i] = 0.178079954393132 * initial_solutions[i] + 0.821920045606868 * solutions[i] + 0.544974750228521 * time_step * stage3_RHS[i];
+        }
+
+        //stage5
+        const auto& stage4_RHS = semi_discrete_equation.calculate_RHS(solutions);
+        for (size_t i = 0; i < num_solution; ++i)
+            solutions[i] = partial_sums[i] + 0.386708617503269 * solutions[i] + 0.226007483236906 * time_step * stage4_RHS[i];
+    }
+};
+
+
+// low storage Runge-Kutta, storage form is given by coefficients
+// 2N storage of Williamson form, coefficients A, B
+//  dU := A_i * dU + dt * L(U)
+//  U  := U + B_i * dU
+//  second register is workspace solution increments
+// 2S* storage of Ketcheson form, coefficients scale, gamma1, gamma2, beta
+//  U  := scale_i * (gamma2_i * U0 + gamma1_i * U + beta_i * dt * L(U))
+//  second register is workspace initial solutions U0, written in first stage
+//  weights are given unnormalized with common scale, so Shu-Osher form of SSPRK33 keeps its operation order
+// registers are updated in one pass after each RHS evaluation
+template <typename Coefficients>
+class Low_Storage_RK : public TIM {
+public:
+    template <typename Semi_Discrete_Eq, typename Solution>
+    static void update_solutions(const Semi_Discrete_Eq& semi_discrete_equation, std::vector<Solution>& solutions, const double time_step) {
+        if constexpr (requires { Coefficients::beta; })
+            update_solutions_2S_star(semi_discrete_equation, solutions, time_step);
+        else
+            update_solutions_2N(semi_discrete_equation, solutions, time_step);
     }
 
 private:
-    static constexpr double c3_ = 1.0 / 3.0;
+    template <typename Semi_Discrete_Eq, typename Solution>
+    static void update_solutions_2N(const Semi_Discrete_Eq& semi_discrete_equation, std::vector<Solution>& solutions, const double time_step) {
+        auto& solution_increments = semi_discrete_equation.workspace().solution_increments;
+        const auto num_solution = solutions.size();
+        solution_increments.resize(num_solution);   // register is allocated at first time step only
+
+        constexpr auto num_stage = Coefficients::A.size();
+        for (size_t i = 0; i < num_stage; ++i) {
+            const auto& RHS = semi_discrete_equation.calculate_RHS(solutions);
+
+            for (size_t j = 0; j < num_solution; ++j) {
+                auto& solution_increment = solution_increments[j];
+                solution_increment *= Coefficients::A[i];    // A_0 = 0 discards previous time step increment
+                solution_increment += RHS[j] * time_step;
+
+                solutions[j] += solution_increment * Coefficients::B[i];
+            }
+        }
+    }
+
+    template <typename Semi_Discrete_Eq, typename Solution>
+    static void update_solutions_2S_star(const Semi_Discrete_Eq& semi_discrete_equation, std::vector<Solution>& solutions, const double time_step) {
+        auto& initial_solutions = semi_discrete_equation.workspace().initial_solutions;
+        const auto num_solution = solutions.size();
+        initial_solutions.resize(num_solution);     // register is allocated at first time step only
+
+        constexpr auto num_stage = Coefficients::beta.size();
+        for (size_t i = 0; i < num_stage; ++i) {
+            const auto& RHS = semi_discrete_equation.calculate_RHS(solutions);
+
+            for (size_t j = 0; j < num_solution; ++j) {
+                if (i == 0)
+                    initial_solutions[j] = solutions[j];
+
+                solutions[j] = Coefficients::scale[i] * (Coefficients::gamma2[i] * initial_solutions[j] + Coefficients::gamma1[i] * solutions[j] + Coefficients::beta[i] * time_step * RHS[j]);
+            }
+        }
+    }
+};
+
+
+// Shu & Osher SSPRK(3,3) in 2S* form
+struct SSPRK33_Coefficients
+{
+    static constexpr std::array<double, 3> scale = { 1.0, 1.0 / 4.0, 1.0 / 3.0 };
+    static constexpr std::array<double, 3> gamma1 = { 1.0, 1.0, 2.0 };
+    static constexpr std::array<double, 3> gamma2 = { 0.0, 3.0, 1.0 };
+    static constexpr std::array<double, 3> beta = { 1.0, 1.0, 2.0 };
+};
+
+struct Williamson_RK3_Coefficients
+{
+    static constexpr std::array<double, 3> A = { 0.0, -5.0 / 9.0, -153.0 / 128.0 };
+    static constexpr std::array<double, 3> B = { 1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0 };
 };
 
+// Carpenter & Kennedy RK4(5) 2N storage
+struct Carpenter_Kennedy_RK4_Coefficients
+{
+    static constexpr std::array<double, 5> A = { 0.0, -567301805773.0 / 1357537059087.0, -2404267990393.0 / 2016746695238.0, -3550918686646.0 / 2091501179385.0, -1275806237668.0 / 842570457699.0 };
+    static constexpr std::array<double, 5> B = { 1432997174477.0 / 9575080441755.0, 5161836677717.0 / 13612068292357.0, 1720146321549.0 / 2090206949498.0, 3134564353537.0 / 4481467310338.0, 2277821191437.0 / 14882151754819.0 };
+};
+
+using SSPRK33 = Low_Storage_RK<SSPRK33_Coefficients>;
+using Williamson_RK3 = Low_Storage_RK<Williamson_RK3_Coefficients>;
+using Carpenter_Kennedy_RK4 = Low_Storage_RK<Carpenter_Kennedy_RK4_Coefficients>;
+
 
 namespace ms {
     template<typename T>
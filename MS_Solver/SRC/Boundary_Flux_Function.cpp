@@ -2,6 +2,10 @@
 
 Slip_Wall_2D::Boundary_Flux_ Slip_Wall_2D::calculate(const Solution_& oc_cvariable, const Space_Vector_& normal) {
 	const auto oc_pvariable = Euler_2D::conservative_to_primitive(oc_cvariable);
+	return calculate(oc_cvariable, oc_pvariable, normal);
+};
+
+Slip_Wall_2D::Boundary_Flux_ Slip_Wall_2D::calculate(const Solution_&, const Solution_& oc_pvariable, const Space_Vector_& normal) {
 	const auto p = oc_pvariable[2];
 	const auto nx = normal[0];
 	const auto ny = normal[1] ;
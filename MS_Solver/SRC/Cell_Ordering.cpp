@@ -0,0 +1,131 @@
+#include "../INC/Cell_Ordering.h"
+
+std::vector<size_t> Reverse_Cuthill_McKee::calculate_cell_order(const size_t num_cell, const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs) {
+	//compressed adjacency
+	std::vector<size_t> start_indexes(num_cell + 1, 0);
+	for (const auto& [oc_index, nc_index] : adjacent_cell_index_pairs) {
+		start_indexes[oc_index + 1]++;
+		start_indexes[nc_index + 1]++;
+	}
+	std::partial_sum(start_indexes.begin(), start_indexes.end(), start_indexes.begin());
+
+	std::vector<size_t> adjacent_cell_indexes(start_indexes.back());
+	auto fill_indexes = start_indexes;
+	for (const auto& [oc_index, nc_index] : adjacent_cell_index_pairs) {
+		adjacent_cell_indexes[fill_indexes[oc_index]++] = nc_index;
+		adjacent_cell_indexes[fill_indexes[nc_index]++] = oc_index;
+	}
+
+	const auto degree = [&](const size_t cell_index) { return start_indexes[cell_index + 1] - start_indexes[cell_index]; };
+	const auto is_lower_degree = [&](const size_t i, const size_t j) { return degree(i) < degree(j); };
+
+	//breadth first search which returns visited cells in level order
+	constexpr auto not_visited = static_cast<size_t>(-1);
+	std::vector<size_t> levels(num_cell, not_visited);
+
+	const auto breadth_first_search = [&](const size_t start_cell_index) {
+		std::vector<size_t> visited_cell_indexes = { start_cell_index };
+		levels[start_cell_index] = 0;
+
+		for (size_t head = 0; head < visited_cell_indexes.size(); ++head) {
+			const auto cell_index = visited_cell_indexes[head];
+			const auto num_visited = visited_cell_indexes.size();
+
+			for (size_t j = start_indexes[cell_index]; j < start_indexes[cell_index + 1]; ++j) {
+				const auto adjacent_cell_index = adjacent_cell_indexes[j];
+				if (levels[adjacent_cell_index] == not_visited) {
+					levels[adjacent_cell_index] = levels[cell_index] + 1;
+					visited_cell_indexes.push_back(adjacent_cell_index);
+				}
+			}
+
+			std::stable_sort(visited_cell_indexes.begin() + num_visited, visited_cell_indexes.end(), is_lower_degree);
+		}
+
+		return visited_cell_indexes;
+	};
+
+	const auto reset_levels = [&](const std::vector<size_t>& visited_cell_indexes) {
+		for (const auto cell_index : visited_cell_indexes)
+			levels[cell_index] = not_visited;
+	};
+
+	std::vector<size_t> cell_indexes_by_degree(num_cell);
+	std::iota(cell_indexes_by_degree.begin(), cell_indexes_by_degree.end(), 0);
+	std::stable_sort(cell_indexes_by_degree.begin(), cell_indexes_by_degree.end(), is_lower_degree);
+
+	std::vector<bool> is_ordered(num_cell, false);
+	std::vector<size_t> cell_order;
+	cell_order.reserve(num_cell);
+
+	for (const auto candidate_cell_index : cell_indexes_by_degree) {
+		if (is_ordered[candidate_cell_index])
+			continue;
+
+		//pseudo peripheral cell : repeat search from lowest degree cell of last level while eccentricity grows
+		auto start_cell_index = candidate_cell_index;
+		auto visited_cell_indexes = breadth_first_search(start_cell_index);
+		while (true) {
+			const auto eccentricity = levels[visited_cell_indexes.back()];
+
+			auto next_start_cell_index = visited_cell_indexes.back();
+			for (auto iter = visited_cell_indexes.rbegin(); iter != visited_cell_indexes.rend() && levels[*iter] == eccentricity; ++iter) {
+				if (degree(*iter) <= degree(next_start_cell_index))
+					next_start_cell_index = *iter;
+			}
+
+			reset_levels(visited_cell_indexes);
+			auto next_visited_cell_indexes = breadth_first_search(next_start_cell_index);
+
+			if (levels[next_visited_cell_indexes.back()] <= eccentricity) {
+				reset_levels(next_visited_cell_indexes);
+				visited_cell_indexes = breadth_first_search(start_cell_index);
+				break;
+			}
+
+			start_cell_index = next_start_cell_index;
+			visited_cell_indexes = std::move(next_visited_cell_indexes);
+		}
+
+		for (const auto cell_index : visited_cell_indexes) {
+			is_ordered[cell_index] = true;
+			cell_order.push_back(cell_index);
+		}
+	}
+
+	std::reverse(cell_order.begin(), cell_order.end());
+	return cell_order;
+}
+
+
+std::uint64_t Hilbert_Curve::hilbert_index(std::uint32_t x, std::uint32_t y) {
+	std::uint64_t index = 0;
+	for (std::uint32_t s = 1u << (num_level_ - 1); s > 0; s >>= 1) {
+		const std::uint32_t rx = (x & s) > 0;
+		const std::uint32_t ry = (y & s) > 0;
+		index += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+
+		//rotate quadrant
+		if (ry == 0) {
+			if (rx == 1) {
+				x = s - 1 - x;
+				y = s - 1 - y;
+			}
+			std::swap(x, y);
+		}
+	}
+	return index;
+}
+
+
+namespace ms {
+	size_t calculate_bandwidth(const std::vector<std::pair<size_t, size_t>>& adjacent_cell_index_pairs) {
+		size_t bandwidth = 0;
+		for (const auto& [oc_index, nc_index] : adjacent_cell_index_pairs) {
+			const auto distance = oc_index < nc_index ? nc_index - oc_index : oc_index - nc_index;
+			if (bandwidth < distance)
+				bandwidth = distance;
+		}
+		return bandwidth;
+	}
+}
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include "../INC/Governing_Equation.h"
 
+#include <algorithm>
+#include <execution>
+#include <ranges>
+
 Linear_Advection_2D::Physical_Flux_ Linear_Advection_2D::physical_flux(const Solution_& solution) {
 	const auto [x_advection_speed, y_advection_speed] = Linear_Advection_2D::advection_speeds_;
 	const auto sol = solution[0];	//scalar
@@ -8,29 +12,25 @@ Linear_Advection_2D::Physical_Flux_ Linear_Advection_2D::physical_flux(const Sol
 	return physical_flux;
 }
 
-std::vector<Linear_Advection_2D::Physical_Flux_> Linear_Advection_2D::physical_fluxes(const std::vector<Solution_>& solutions) {
+void Linear_Advection_2D::physical_fluxes(const std::vector<Solution_>& solutions, std::vector<Physical_Flux_>& physical_fluxes) {
 	//static size_t num_solution = solutions.size();
 	const size_t num_solution = solutions.size();
 
 	const auto [x_advection_speed, y_advection_speed] = Linear_Advection_2D::advection_speeds_;
-	std::vector<Physical_Flux_> physical_fluxes(num_solution);
-	for (size_t i = 0; i < num_solution; ++i) {
+	physical_fluxes.resize(num_solution);
+
+	const auto indexes = std::views::iota(size_t{ 0 }, num_solution);
+	std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
 		const auto sol = solutions[i][0];	//scalar
 		physical_fluxes[i] = { x_advection_speed * sol , y_advection_speed * sol };
-	}
-
-	return physical_fluxes;
+	});
 }
 
-std::vector<std::array<double, Linear_Advection_2D::space_dimension_>> Linear_Advection_2D::coordinate_projected_maximum_lambdas(const std::vector<Solution_>& solutions) {
-	//static size_t num_solution = solutions.size();
-	const size_t num_solution = solutions.size();
-
+std::array<double, Linear_Advection_2D::space_dimension_> Linear_Advection_2D::coordinate_projected_maximum_lambda(const Solution_& solution) {
 	static double absolute_x_advection_speed = std::abs(advection_speeds_[0]);
 	static double absolute_y_advection_speed = std::abs(advection_speeds_[1]);
 
-	std::vector<std::array<double, Linear_Advection_2D::space_dimension_>> projected_maximum_lambdas(num_solution, { absolute_x_advection_speed,absolute_y_advection_speed });
-	return projected_maximum_lambdas;
+	return { absolute_x_advection_speed, absolute_y_advection_speed };
 }
 
 double Linear_Advection_2D::inner_face_maximum_lambda(const Solution_& solution_o, const Solution_& solution_n, const Space_Vector_& nomal_vector) {
@@ -45,30 +45,23 @@ Burgers_2D::Physical_Flux_ Burgers_2D::physical_flux(const Solution_& solution)
 	return { temp_val, temp_val };
 }
 
-std::vector<Burgers_2D::Physical_Flux_> Burgers_2D::physical_fluxes(const std::vector<Solution_>& solutions) {
+void Burgers_2D::physical_fluxes(const std::vector<Solution_>& solutions, std::vector<Physical_Flux_>& physical_fluxes) {
 	static size_t num_solution = solutions.size();
 
 
-	std::vector<Physical_Flux_> physical_fluxes(num_solution);
-	for (size_t i = 0; i < num_solution; ++i) {
+	physical_fluxes.resize(num_solution);
+
+	const auto indexes = std::views::iota(size_t{ 0 }, num_solution);
+	std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
 		const auto sol = solutions[i][0];
 		const auto temp_val = 0.5 * sol * sol;
 		physical_fluxes[i] = { temp_val, temp_val };
-	}
-
-	return physical_fluxes;
+	});
 }
 
-std::vector<std::array<double, Burgers_2D::space_dimension_>> Burgers_2D::coordinate_projected_maximum_lambdas(const std::vector<Solution_>& solutions) {
-	static size_t num_solution = solutions.size();
-
-	std::vector<std::array<double, Burgers_2D::space_dimension_>> projected_maximum_lambdas(num_solution);
-	for (size_t i = 0; i < num_solution; ++i) {
-		const auto maximum_lambdas = std::abs(solutions[i][0]);
-		projected_maximum_lambdas[i] = { maximum_lambdas, maximum_lambdas };
-	}
-
-	return projected_maximum_lambdas;
+std::array<double, Burgers_2D::space_dimension_> Burgers_2D::coordinate_projected_maximum_lambda(const Solution_& solution) {
+	const auto maximum_lambdas = std::abs(solution[0]);
+	return { maximum_lambdas, maximum_lambdas };
 }
 
 double Burgers_2D::inner_face_maximum_lambda(const Solution_& solution_o, const Solution_& solution_n, const Space_Vector_& nomal_vector) {
@@ -94,23 +87,25 @@ Euler_2D::Solution_ Euler_2D::conservative_to_primitive(const Solution_& conserv
 	return { u,v,p,a };
 }
 
-std::vector<std::array<double, Euler_2D::space_dimension_>> Euler_2D::coordinate_projected_maximum_lambdas(const std::vector<Solution_>& primitive_variables) {
-	static size_t num_solution = primitive_variables.size();
+void Euler_2D::conservative_to_primitive(const std::vector<Solution_>& conservative_variables, std::vector<Solution_>& primitive_variables) {
+	const auto num_solution = conservative_variables.size();
+	primitive_variables.resize(num_solution);
 
-	std::vector<std::array<double,space_dimension_>> coordinate_projected_maximum_lambdas(num_solution);
-
-	for (size_t i = 0; i < num_solution; ++i) {
-		const auto u = primitive_variables[i][0];
-		const auto v = primitive_variables[i][1];
-		const auto a = primitive_variables[i][3];
+	const auto indexes = std::views::iota(size_t{ 0 }, num_solution);
+	std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
+		primitive_variables[i] = conservative_to_primitive(conservative_variables[i]);
+	});
+}
 
-		const auto x_projected_maximum_lambda = std::abs(u) + a;
-		const auto y_projected_maximum_lambda = std::abs(v) + a;
+std::array<double, Euler_2D::space_dimension_> Euler_2D::coordinate_projected_maximum_lambda(const Solution_& primitive_variable) {
+	const auto u = primitive_variable[0];
+	const auto v = primitive_variable[1];
+	const auto a = primitive_variable[3];
 
-		coordinate_projected_maximum_lambdas[i] = { x_projected_maximum_lambda, y_projected_maximum_lambda };
-	}
+	const auto x_projected_maximum_lambda = std::abs(u) + a;
+	const auto y_projected_maximum_lambda = std::abs(v) + a;
 
-	return coordinate_projected_maximum_lambdas;
+	return { x_projected_maximum_lambda, y_projected_maximum_lambda };
 }
 
 Euler_2D::Physical_Flux_ Euler_2D::physical_flux(const Solution_& cvariable) {
@@ -139,16 +134,15 @@ Euler_2D::Physical_Flux_ Euler_2D::physical_flux(const Solution_& conservative_v
 	};
 }
 
-std::vector<Euler_2D::Physical_Flux_> Euler_2D::physical_fluxes(const std::vector<Solution_>& conservative_variables, const std::vector<Solution_>& primitive_variables) {
+void Euler_2D::physical_fluxes(const std::vector<Solution_>& conservative_variables, const std::vector<Solution_>& primitive_variables, std::vector<Physical_Flux_>& physical_fluxes) {
 	static const size_t num_solution = conservative_variables.size();
 	
-	std::vector<Physical_Flux_> physical_fluxes;
-	physical_fluxes.reserve(num_solution);
+	physical_fluxes.resize(num_solution);
 
-	for (size_t i = 0; i < num_solution; ++i) 
-		physical_fluxes.push_back(physical_flux(conservative_variables[i], primitive_variables[i]));
-	
-	return physical_fluxes;
+	const auto indexes = std::views::iota(size_t{ 0 }, num_solution);
+	std::for_each(std::execution::par, indexes.begin(), indexes.end(), [&](const size_t i) {
+		physical_fluxes[i] = physical_flux(conservative_variables[i], primitive_variables[i]);
+	});
 }
 
 double Euler_2D::inner_face_maximum_lambda(const Solution_& oc_primitive_variable, const Solution_& nc_primitive_variable, const Space_Vector_& nomal_vector) {
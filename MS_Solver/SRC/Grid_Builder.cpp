@@ -0,0 +1,41 @@
+#include "../INC/Grid_Builder.h"
+
+size_t Vnode_To_Cell_CSR::num_vnode(void) const {
+	return this->start_indexes.empty() ? 0 : this->start_indexes.size() - 1;
+}
+
+std::span<const size_t> Vnode_To_Cell_CSR::share_cell_indexes(const size_t vnode_index) const {
+	dynamic_require(vnode_index < this->num_vnode(), "vnode index should be less than number of vnode");
+
+	const auto start_index = this->start_indexes[vnode_index];
+	const auto end_index = this->start_indexes[vnode_index + 1];
+	return { this->cell_indexes.data() + start_index, end_index - start_index };
+}
+
+
+namespace ms {
+	Vnode_To_Cell_CSR make_vnode_to_cell_csr(const std::vector<std::pair<size_t, size_t>>& vnode_cell_index_pairs) {
+		size_t num_vnode = 0;
+		for (const auto& [vnode_index, cell_index] : vnode_cell_index_pairs) {
+			if (num_vnode <= vnode_index)
+				num_vnode = vnode_index + 1;
+		}
+
+		//count share cells of each vnode
+		Vnode_To_Cell_CSR vnode_to_cell_csr;
+		auto& [start_indexes, cell_indexes] = vnode_to_cell_csr;
+
+		start_indexes.resize(num_vnode + 1, 0);
+		for (const auto& [vnode_index, cell_index] : vnode_cell_index_pairs)
+			start_indexes[vnode_index + 1]++;
+		std::partial_sum(start_indexes.begin(), start_indexes.end(), start_indexes.begin());
+
+		//fill keeps order of pairs in each row
+		cell_indexes.resize(start_indexes.back());
+		auto fill_indexes = start_indexes;
+		for (const auto& [vnode_index, cell_index] : vnode_cell_index_pairs)
+			cell_indexes[fill_indexes[vnode_index]++] = cell_index;
+
+		return vnode_to_cell_csr;
+	}
+}
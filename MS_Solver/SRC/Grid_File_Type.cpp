@@ -1,4 +1,364 @@
 #include "../INC/Grid_File_Type.h"
+#include "../INC/Memory_Mapped_File.h"
+
+#include <charconv>
+#include <cstdint>
+
+template <typename T>
+T Gmsh::Cursor::read(void) {
+	if (this->is_binary)
+		return this->read_binary<T>();
+	else
+		return this->read_ascii<T>();
+}
+
+template <typename T>
+T Gmsh::Cursor::read_ascii(void) {
+	while (this->position != this->end && (*this->position == ' ' || *this->position == '\t' || *this->position == '\r' || *this->position == '\n'))
+		++this->position;
+
+	T value;
+	const auto [value_end, error_code] = std::from_chars(this->position, this->end, value);
+	dynamic_require(error_code == std::errc(), "fail to parse grid file");
+
+	this->position = value_end;
+	return value;
+}
+
+template <typename T>
+T Gmsh::Cursor::read_binary(void) {
+	dynamic_require(sizeof(T) <= static_cast<size_t>(this->end - this->position), "grid file ends in the middle of binary data");
+
+	T value;
+	std::copy_n(this->position, sizeof(T), reinterpret_cast<char*>(&value));
+
+	this->position += sizeof(T);
+	return value;
+}
+
+size_t Gmsh::Cursor::read_size(void) {
+	// binary size is 8 byte whatever machine size_t is, $MeshFormat checks it fits
+	if (this->is_binary)
+		return static_cast<size_t>(this->read_binary<std::uint64_t>());
+	else
+		return this->read_ascii<size_t>();
+}
+
+void Gmsh::Cursor::skip_line(void) {
+	const auto line_end = std::find(this->position, this->end, '\n');
+	this->position = line_end == this->end ? this->end : line_end + 1;
+}
+
+
+Grid_File_Data Gmsh::read_grid_file(const std::string& grid_file_path) {
+	const Memory_Mapped_File grid_file(grid_file_path);
+	const auto file_view = grid_file.view();
+
+	Cursor cursor = { file_view.data(), file_view.data() + file_view.size() };
+	Grid_File_Data grid_file_data;
+
+	double version = 0.0;
+	std::map<Entity_, index> entity_to_physical_group_index;
+
+	// sections are read in the order they appear, every section is visited once
+	while (true) {
+		const auto section_name = read_section_name(cursor);
+		if (section_name.empty())
+			break;
+
+		if (section_name == "MeshFormat") {
+			version = cursor.read_ascii<double>();
+			const auto file_type = cursor.read_ascii<int>();
+			const auto data_size = cursor.read_ascii<int>();
+			cursor.skip_line();
+
+			const auto is_version_2 = 2.0 <= version && version < 3.0;
+			const auto is_version_4 = 4.1 <= version && version < 5.0;
+			dynamic_require(is_version_2 || is_version_4, "grid file should be gmsh 2.2 or 4.1 format");
+			dynamic_require(data_size == sizeof(double), "gmsh data size should be 8");
+
+			cursor.is_binary = file_type == 1;
+			if (cursor.is_binary) {
+				// 8 byte sizes and tags of binary 4.1 file are stored in size_t
+				if (is_version_4)
+					dynamic_require(sizeof(size_t) == sizeof(std::uint64_t), "binary gmsh 4.1 grid file needs 64 bit size_t");
+
+				// binary one is written to check byte order
+				dynamic_require(cursor.read_binary<int>() == 1, "byte order of binary grid file should be same with machine");
+				cursor.skip_line();
+			}
+		}
+		else if (section_name == "PhysicalNames")
+			read_physical_names(cursor, grid_file_data);
+		else if (section_name == "Entities")
+			read_entities_v4(cursor, entity_to_physical_group_index);
+		else if (section_name == "Nodes") {
+			dynamic_require(version != 0.0, "$MeshFormat should come before $Nodes");
+			if (version < 3.0)
+				read_nodes_v2(cursor, grid_file_data);
+			else
+				read_nodes_v4(cursor, grid_file_data);
+		}
+		else if (section_name == "Elements") {
+			dynamic_require(version != 0.0, "$MeshFormat should come before $Elements");
+			if (version < 3.0)
+				read_elements_v2(cursor, grid_file_data);
+			else
+				read_elements_v4(cursor, entity_to_physical_group_index, grid_file_data);
+		}
+
+		skip_section(cursor, section_name);
+	}
+
+	dynamic_require(!grid_file_data.node_coordinates.empty(), "grid file should have $Nodes");
+	dynamic_require(!grid_file_data.element_figure_type_indexes.empty(), "grid file should have $Elements");
+	return grid_file_data;
+}
+
+std::string_view Gmsh::read_section_name(Cursor& cursor) {
+	// section starts with "$section_name" line, empty name when file ends
+	while (cursor.position != cursor.end && *cursor.position != '$')
+		cursor.skip_line();
+
+	if (cursor.position == cursor.end)
+		return {};
+
+	const auto name_start = cursor.position + 1;
+	auto name_end = name_start;
+	while (name_end != cursor.end && *name_end != '\r' && *name_end != '\n')
+		++name_end;
+
+	cursor.skip_line();
+	return std::string_view(name_start, name_end - name_start);
+}
+
+void Gmsh::skip_section(Cursor& cursor, const std::string_view section_name) {
+	// read sections end right before their end tag, so search only passes skipped sections
+	const auto end_tag = "$End" + std::string(section_name);
+	const auto end_tag_position = std::search(cursor.position, cursor.end, end_tag.begin(), end_tag.end());
+	dynamic_require(end_tag_position != cursor.end, "grid file should have " + end_tag);
+
+	cursor.position = end_tag_position;
+	cursor.skip_line();
+}
+
+void Gmsh::read_physical_names(Cursor& cursor, Grid_File_Data& grid_file_data) {
+	// physical names are written in ascii even in binary file
+	const auto num_physical_name = cursor.read_ascii<size_t>();
+	grid_file_data.physical_group_index_name_pairs.reserve(num_physical_name);
+
+	// physical name line := dimension, physical group index, "name"
+	for (size_t i = 0; i < num_physical_name; ++i) {
+		cursor.read_ascii<int>();
+		const auto physical_group_index = cursor.read_ascii<index>();
+
+		const auto name_start = std::find(cursor.position, cursor.end, '"');
+		dynamic_require(name_start != cursor.end, "physical name should be quoted");
+		const auto name_end = std::find(name_start + 1, cursor.end, '"');
+		dynamic_require(name_end != cursor.end, "physical name should be quoted");
+
+		grid_file_data.physical_group_index_name_pairs.emplace_back(physical_group_index, std::string(name_start + 1, name_end));
+		cursor.position = name_end + 1;
+	}
+}
+
+void Gmsh::read_nodes_v2(Cursor& cursor, Grid_File_Data& grid_file_data) {
+	// node := tag, x, y, z (binary tag is int)
+	const auto num_node = cursor.read_ascii<size_t>();
+	if (cursor.is_binary)
+		cursor.skip_line();
+
+	auto& node_coordinates = grid_file_data.node_coordinates;
+	node_coordinates.resize(3 * num_node);
+
+	for (size_t i = 0; i < num_node; ++i) {
+		const auto node_tag = static_cast<size_t>(cursor.read<int>());
+		dynamic_require(0 < node_tag, "Gmsh node tag should start with 1");
+
+		//node tags are not always contiguous
+		if (node_coordinates.size() < 3 * node_tag)
+			node_coordinates.resize(3 * node_tag);
+
+		const auto coordinates = node_coordinates.data() + 3 * (node_tag - 1);
+		for (size_t j = 0; j < 3; ++j)
+			coordinates[j] = cursor.read<double>();
+	}
+}
+
+void Gmsh::read_elements_v2(Cursor& cursor, Grid_File_Data& grid_file_data) {
+	const auto num_element = cursor.read_ascii<size_t>();
+	if (cursor.is_binary)
+		cursor.skip_line();
+
+	auto& figure_type_indexes = grid_file_data.element_figure_type_indexes;
+	auto& physical_group_indexes = grid_file_data.element_physical_group_indexes;
+	auto& node_start_indexes = grid_file_data.element_node_start_indexes;
+	auto& node_indexes = grid_file_data.element_node_indexes;
+
+	figure_type_indexes.reserve(num_element);
+	physical_group_indexes.reserve(num_element);
+	node_start_indexes.reserve(num_element + 1);
+	node_start_indexes.push_back(0);
+	node_indexes.reserve(4 * num_element);
+
+	// ascii element := number, figure type index, number of tag, tags (physical group index first), node tags
+	// binary elements are grouped by header := figure type index, number of element, number of tag, and element := number, tags, node tags
+	while (figure_type_indexes.size() < num_element) {
+		index figure_type_index = 0;
+		size_t num_element_in_group = 1;
+		size_t num_tag = 0;
+		if (cursor.is_binary) {
+			figure_type_index = cursor.read_binary<int>();
+			num_element_in_group = cursor.read_binary<int>();
+			num_tag = cursor.read_binary<int>();
+		}
+
+		for (size_t i = 0; i < num_element_in_group; ++i) {
+			cursor.read<int>();
+			if (!cursor.is_binary) {
+				figure_type_index = cursor.read_ascii<index>();
+				num_tag = cursor.read_ascii<size_t>();
+			}
+
+			dynamic_require(0 < num_tag, "element should have physical group tag");
+			physical_group_indexes.push_back(cursor.read<int>());
+			for (size_t j = 1; j < num_tag; ++j)
+				cursor.read<int>();
+
+			const auto num_node = figure_type_index_to_num_node(figure_type_index);
+			for (size_t j = 0; j < num_node; ++j)
+				node_indexes.push_back(cursor.read<int>() - 1);	//Gmsh node index start with 1
+
+			figure_type_indexes.push_back(figure_type_index);
+			node_start_indexes.push_back(node_indexes.size());
+		}
+	}
+}
+
+void Gmsh::read_entities_v4(Cursor& cursor, std::map<Entity_, index>& entity_to_physical_group_index) {
+	// point := tag, x, y, z, physical tags
+	// curve, surface, volume := tag, bounding box, physical tags, bounding entity tags
+	// where tags := number of tag (size_t), tags (int)
+	std::array<size_t, 4> num_entities;
+	for (auto& num_entity : num_entities)
+		num_entity = cursor.read_size();
+
+	for (int dimension = 0; dimension < 4; ++dimension) {
+		for (size_t i = 0; i < num_entities[dimension]; ++i) {
+			const auto entity_tag = cursor.read<int>();
+
+			const auto num_coordinate = dimension == 0 ? 3 : 6;
+			for (int j = 0; j < num_coordinate; ++j)
+				cursor.read<double>();
+
+			const auto num_physical_tag = cursor.read_size();
+			for (size_t j = 0; j < num_physical_tag; ++j) {
+				const auto physical_tag = cursor.read<int>();
+				if (j == 0)
+					entity_to_physical_group_index.emplace(Entity_(dimension, entity_tag), physical_tag);
+			}
+
+			if (dimension != 0) {
+				const auto num_bounding_entity = cursor.read_size();
+				for (size_t j = 0; j < num_bounding_entity; ++j)
+					cursor.read<int>();
+			}
+		}
+	}
+}
+
+void Gmsh::read_nodes_v4(Cursor& cursor, Grid_File_Data& grid_file_data) {
+	// header := number of block, number of node, min tag, max tag
+	// block := dimension, entity tag, parametric (int), number of node (size_t), node tags (size_t), coordinates (+ parametric coordinates)
+	const auto num_block = cursor.read_size();
+	cursor.read_size();
+	cursor.read_size();
+	const auto max_node_tag = cursor.read_size();
+
+	auto& node_coordinates = grid_file_data.node_coordinates;
+	node_coordinates.resize(3 * max_node_tag);
+
+	std::vector<size_t> node_tags;
+	for (size_t i = 0; i < num_block; ++i) {
+		const auto dimension = cursor.read<int>();
+		cursor.read<int>();
+		const auto is_parametric = cursor.read<int>() == 1;
+		const auto num_node_in_block = cursor.read_size();
+
+		node_tags.resize(num_node_in_block);
+		for (auto& node_tag : node_tags) {
+			node_tag = cursor.read_size();
+			dynamic_require(0 < node_tag && node_tag <= max_node_tag, "Gmsh node tag should be in [1, max node tag]");
+		}
+
+		const auto num_parametric_coordinate = is_parametric ? dimension : 0;
+		for (const auto node_tag : node_tags) {
+			const auto coordinates = node_coordinates.data() + 3 * (node_tag - 1);
+			for (size_t j = 0; j < 3; ++j)
+				coordinates[j] = cursor.read<double>();
+
+			for (int j = 0; j < num_parametric_coordinate; ++j)
+				cursor.read<double>();
+		}
+	}
+}
+
+void Gmsh::read_elements_v4(Cursor& cursor, const std::map<Entity_, index>& entity_to_physical_group_index, Grid_File_Data& grid_file_data) {
+	// header := number of block, number of element, min tag, max tag
+	// block := dimension, entity tag, figure type index (int), number of element (size_t), elements := tag, node tags (size_t)
+	const auto num_block = cursor.read_size();
+	const auto num_element = cursor.read_size();
+	cursor.read_size();
+	cursor.read_size();
+
+	auto& figure_type_indexes = grid_file_data.element_figure_type_indexes;
+	auto& physical_group_indexes = grid_file_data.element_physical_group_indexes;
+	auto& node_start_indexes = grid_file_data.element_node_start_indexes;
+	auto& node_indexes = grid_file_data.element_node_indexes;
+
+	figure_type_indexes.reserve(num_element);
+	physical_group_indexes.reserve(num_element);
+	node_start_indexes.reserve(num_element + 1);
+	node_start_indexes.push_back(0);
+	node_indexes.reserve(4 * num_element);
+
+	for (size_t i = 0; i < num_block; ++i) {
+		const auto dimension = cursor.read<int>();
+		const auto entity_tag = cursor.read<int>();
+		const auto figure_type_index = static_cast<index>(cursor.read<int>());
+		const auto num_element_in_block = cursor.read_size();
+
+		const auto iter = entity_to_physical_group_index.find(Entity_(dimension, entity_tag));
+		dynamic_require(iter != entity_to_physical_group_index.end(), "entity of element should belong to physical group in $Entities");
+		const auto physical_group_index = iter->second;
+
+		const auto num_node = figure_type_index_to_num_node(figure_type_index);
+		for (size_t j = 0; j < num_element_in_block; ++j) {
+			cursor.read_size();
+			for (size_t k = 0; k < num_node; ++k)
+				node_indexes.push_back(cursor.read_size() - 1);	//Gmsh node index start with 1
+
+			figure_type_indexes.push_back(figure_type_index);
+			physical_group_indexes.push_back(physical_group_index);
+			node_start_indexes.push_back(node_indexes.size());
+		}
+	}
+}
+
+size_t Gmsh::figure_type_index_to_num_node(const index figure_type_index) {
+	// every listed gmsh figure is complete lagrange element
+	const size_t n = figure_type_index_to_figure_order(figure_type_index) + 1;
+	switch (figure_type_index_to_element_figure(figure_type_index)) {
+	case Figure::line:				return n;
+	case Figure::triangle:			return n * (n + 1) / 2;
+	case Figure::quadrilateral:		return n * n;
+	case Figure::tetrahedral:		return n * (n + 1) * (n + 2) / 6;
+	case Figure::hexahedral:		return n * n * n;
+	case Figure::prism:				return n * n * (n + 1) / 2;
+	case Figure::pyramid:			return n * (n + 1) * (2 * n + 1) / 6;
+	default:						return 1;
+	}
+}
 
 order Gmsh::figure_type_index_to_figure_order(const index element_type_indx) {
 	switch (static_cast<GmshFigureType>(element_type_indx)) {
@@ -0,0 +1,77 @@
+#include "../INC/Memory_Mapped_File.h"
+#include "../INC/Text.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+Memory_Mapped_File::Memory_Mapped_File(const std::string& file_path) {
+	const auto file_handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	dynamic_require(file_handle != INVALID_HANDLE_VALUE, "fail to open " + file_path);
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file_handle, &file_size)) {
+		CloseHandle(file_handle);
+		throw std::runtime_error("fail to get size of " + file_path);
+	}
+	this->size_ = static_cast<size_t>(file_size.QuadPart);
+
+	//empty file can not be mapped
+	if (this->size_ != 0) {
+		const auto mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_handle != nullptr) {
+			this->data_ = static_cast<const char*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+			CloseHandle(mapping_handle);
+		}
+	}
+
+	//view keeps mapping valid after both handles are closed
+	CloseHandle(file_handle);
+	dynamic_require(this->size_ == 0 || this->data_ != nullptr, "fail to map " + file_path);
+}
+
+Memory_Mapped_File::~Memory_Mapped_File(void) {
+	if (this->data_ != nullptr)
+		UnmapViewOfFile(this->data_);
+}
+#else
+Memory_Mapped_File::Memory_Mapped_File(const std::string& file_path) {
+	const auto file_descriptor = open(file_path.c_str(), O_RDONLY);
+	dynamic_require(file_descriptor != -1, "fail to open " + file_path);
+
+	struct stat file_status;
+	if (fstat(file_descriptor, &file_status) == -1) {
+		close(file_descriptor);
+		throw std::runtime_error("fail to get size of " + file_path);
+	}
+	this->size_ = static_cast<size_t>(file_status.st_size);
+
+	//empty file can not be mapped
+	if (this->size_ != 0) {
+		const auto data = mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+		if (data != MAP_FAILED) {
+			madvise(data, this->size_, MADV_SEQUENTIAL);
+			this->data_ = static_cast<const char*>(data);
+		}
+	}
+
+	//mapping stays valid after file is closed
+	close(file_descriptor);
+	dynamic_require(this->size_ == 0 || this->data_ != nullptr, "fail to map " + file_path);
+}
+
+Memory_Mapped_File::~Memory_Mapped_File(void) {
+	if (this->data_ != nullptr)
+		munmap(const_cast<char*>(this->data_), this->size_);
+}
+#endif
+
+std::string_view Memory_Mapped_File::view(void) const {
+	return std::string_view(this->data_, this->size_);
+}
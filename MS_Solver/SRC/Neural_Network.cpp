@@ -0,0 +1,132 @@
+#include "../INC/Neural_Network.h"
+#include "../INC/SIMD.h"
+
+#include <cmath>
+#include <cstdint>
+
+Neural_Network::Neural_Network(const std::string& weight_file_path) {
+	std::ifstream weight_file_stream(weight_file_path, std::ios::binary);
+	dynamic_require(weight_file_stream.is_open(), "fail to open " + weight_file_path);
+
+	const auto read_size = [&](void) {
+		std::uint64_t value = 0;
+		weight_file_stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+		return static_cast<size_t>(value);
+	};
+	const auto read_doubles = [&](std::vector<double>& values, const size_t num_value) {
+		values.resize(num_value);
+		weight_file_stream.read(reinterpret_cast<char*>(values.data()), num_value * sizeof(double));
+	};
+
+	const auto num_layer = read_size();
+	dynamic_require(weight_file_stream && 0 < num_layer, "weight file should have at least one layer");
+
+	this->layers_.resize(num_layer);
+	for (auto& layer : this->layers_) {
+		layer.num_input = read_size();
+		layer.num_output = read_size();
+		const auto activation = read_size();
+		dynamic_require(weight_file_stream && activation <= static_cast<size_t>(Activation::sigmoid), "weight file has unknown activation");
+		layer.activation = static_cast<Activation>(activation);
+
+		read_doubles(layer.weights, layer.num_input * layer.num_output);
+		read_doubles(layer.biases, layer.num_output);
+		dynamic_require(weight_file_stream, "weight file ends before every layer is read");
+	}
+
+	for (size_t i = 1; i < num_layer; ++i)
+		dynamic_require(this->layers_[i - 1].num_output == this->layers_[i].num_input, "number of input of layer should be same with number of output of previous layer");
+}
+
+size_t Neural_Network::num_input(void) const {
+	return this->layers_.front().num_input;
+}
+
+size_t Neural_Network::num_output(void) const {
+	return this->layers_.back().num_output;
+}
+
+void Neural_Network::infer(const double* inputs, const size_t num_batch, double* outputs, std::array<std::vector<double>, 2>& layer_output_buffers) const {
+	const auto num_layer = this->layers_.size();
+
+	// intermediate outputs ping pong between two buffers, which only grow when batch gets bigger
+	const double* layer_inputs = inputs;
+	for (size_t i = 0; i < num_layer; ++i) {
+		const auto& layer = this->layers_[i];
+		const auto num_value = num_batch * layer.num_output;
+
+		double* layer_outputs = outputs;
+		if (i != num_layer - 1) {
+			auto& buffer = layer_output_buffers[i % 2];
+			if (buffer.size() < num_value)
+				buffer.resize(num_value);
+			layer_outputs = buffer.data();
+		}
+
+		multiply_add(layer_inputs, num_batch, layer, layer_outputs);
+		activate(layer.activation, layer_outputs, num_value);
+
+		layer_inputs = layer_outputs;
+	}
+}
+
+void Neural_Network::multiply_add(const double* inputs, const size_t num_batch, const Layer& layer, double* outputs) {
+	// outputs := inputs * weights + biases, blocked so that weight rows of an input block are reused by every row of a batch block
+	const auto num_input = layer.num_input;
+	const auto num_output = layer.num_output;
+	const auto weights = layer.weights.data();
+	const auto biases = layer.biases.data();
+
+	for (size_t b = 0; b < num_batch; ++b)
+		std::copy(biases, biases + num_output, outputs + b * num_output);
+
+	for (size_t batch_start = 0; batch_start < num_batch; batch_start += batch_block_size_) {
+		const auto batch_end = batch_start + batch_block_size_ < num_batch ? batch_start + batch_block_size_ : num_batch;
+
+		for (size_t input_start = 0; input_start < num_input; input_start += input_block_size_) {
+			const auto input_end = input_start + input_block_size_ < num_input ? input_start + input_block_size_ : num_input;
+
+			for (size_t b = batch_start; b < batch_end; ++b) {
+				const auto input_row = inputs + b * num_input;
+				const auto output_row = outputs + b * num_output;
+
+				for (size_t i = input_start; i < input_end; ++i) {
+					const auto input = input_row[i];
+					const auto weight_row = weights + i * num_output;
+
+					size_t o = 0;
+#if defined(SIMD_LOAD)
+					const auto packed_input = SIMD_SET(input);
+					for (; o + simd_width <= num_output; o += simd_width)
+						SIMD_STORE(output_row + o, SIMD_ADD(SIMD_LOAD(output_row + o), SIMD_MUL(SIMD_LOAD(weight_row + o), packed_input)));
+#endif
+					for (; o < num_output; ++o)
+						output_row[o] += weight_row[o] * input;
+				}
+			}
+		}
+	}
+}
+
+void Neural_Network::activate(const Activation activation, double* values, const size_t num_value) {
+	switch (activation)
+	{
+	case Activation::identity:
+		break;
+	case Activation::relu:
+		for (size_t i = 0; i < num_value; ++i)
+			values[i] = values[i] < 0.0 ? 0.0 : values[i];
+		break;
+	case Activation::tanh:
+		for (size_t i = 0; i < num_value; ++i)
+			values[i] = std::tanh(values[i]);
+		break;
+	case Activation::sigmoid:
+		for (size_t i = 0; i < num_value; ++i)
+			values[i] = 1.0 / (1.0 + std::exp(-values[i]));
+		break;
+	default:
+		throw std::runtime_error("wrong activation");
+		break;
+	}
+}
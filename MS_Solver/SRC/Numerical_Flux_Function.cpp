@@ -1,18 +1,18 @@
 #include "../INC/Numerical_Flux_Function.h"
+#include "../INC/SIMD.h"
 
-std::vector<LLF<Euler_2D>::Numerical_Flux_> LLF<Euler_2D>::calculate(const std::vector<Solution_>& conservative_variables, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs) {
-    const auto num_cell = conservative_variables.size();
+void LLF<Euler_2D>::calculate(Solver_Workspace_& workspace, const std::vector<Solution_>& conservative_variables, const std::vector<Space_Vector_>& normals, const std::vector<std::pair<size_t, size_t>>& oc_nc_index_pairs) {
+    const auto& primitive_variables = workspace.primitive_variables;
 
-    std::vector<Solution_> primitive_variables(num_cell);
-    for (size_t i = 0; i < num_cell; ++i)
-        primitive_variables[i] = Euler_2D::conservative_to_primitive(conservative_variables[i]);
-
-    const auto physical_fluxes = Euler_2D::physical_fluxes(conservative_variables, primitive_variables);
+    auto& physical_fluxes = workspace.physical_fluxes;
+    Euler_2D::physical_fluxes(conservative_variables, primitive_variables, physical_fluxes);
 
     const auto num_inner_face = normals.size();
 
-    std::vector<Numerical_Flux_> inner_face_numerical_fluxes(num_inner_face);
-    for (size_t i = 0; i < num_inner_face; ++i) {
+    // every face writes only its own flux, so faces are calculated concurrently
+    auto& inner_face_numerical_fluxes = workspace.face_fluxes;
+    const auto face_indexes = std::views::iota(size_t{ 0 }, num_inner_face);
+    std::for_each(std::execution::par, face_indexes.begin(), face_indexes.end(), [&](const size_t i) {
         const auto [oc_index, nc_index] = oc_nc_index_pairs[i];
         const auto& oc_physical_flux = physical_fluxes[oc_index];
         const auto& nc_physical_flux = physical_fluxes[nc_index];
@@ -25,8 +25,7 @@ std::vector<LLF<Euler_2D>::Numerical_Flux_> LLF<Euler_2D>::calculate(const std::
         const auto inner_face_maximum_lambda = Euler_2D::inner_face_maximum_lambda(oc_side_pvariable, nc_side_pvariable, normal);
 
         inner_face_numerical_fluxes[i] = 0.5 * ((oc_physical_flux + nc_physical_flux) * normal + inner_face_maximum_lambda * (oc_side_cvariable - nc_side_cvariable));
-    }
-    return inner_face_numerical_fluxes;
+    });
 };
 
 LLF<Euler_2D>::Numerical_Flux_ LLF<Euler_2D>::calculate(const Solution_& oc_side_cvariable, const Solution_& nc_side_cvariable, const Space_Vector_& normal) {
@@ -39,4 +38,92 @@ LLF<Euler_2D>::Numerical_Flux_ LLF<Euler_2D>::calculate(const Solution_& oc_side
 
     Numerical_Flux_ LLF_flux = 0.5 * ((oc_physical_flux + nc_physical_flux) * normal + inner_face_maximum_lambda * (oc_side_cvariable - nc_side_cvariable));
     return LLF_flux;
+}
+
+void LLF<Euler_2D>::calculate(Face_State_Block_& face_state_block) {
+    const auto num_face = face_state_block.num_face;
+    const auto& oc_side_cvariables = face_state_block.oc_side_solutions;
+    const auto& nc_side_cvariables = face_state_block.nc_side_solutions;
+    const auto& normals = face_state_block.normals;
+    auto& numerical_fluxes = face_state_block.numerical_fluxes;
+
+    size_t i = 0;
+#if defined(SIMD_LOAD)
+    constexpr auto gamma = 1.4;
+    const auto packed_zero = SIMD_SET(0.0);
+    const auto packed_one = SIMD_SET(1.0);
+    const auto packed_half = SIMD_SET(0.5);
+    const auto packed_gamma = SIMD_SET(gamma);
+    const auto packed_gamma_minus_one = SIMD_SET(gamma - 1);
+
+    // built-in arrays, since std::array drops alignment attribute of packed double template argument
+    struct Packed_Side_State
+    {
+        Packed_Double_ cvariable[4];
+        Packed_Double_ pvariable[4];
+        Packed_Double_ physical_flux[8];    //row major
+    };
+
+    // same operation order with Euler_2D::conservative_to_primitive and Euler_2D::physical_flux
+    const auto load_side_state = [&](const std::array<std::array<double, Face_State_Block_::capacity_>, 4>& cvariables) {
+        Packed_Side_State state;
+        for (size_t e = 0; e < 4; ++e)
+            state.cvariable[e] = SIMD_LOAD(cvariables[e].data() + i);
+
+        const auto [rho, rhou, rhov, rhoE] = state.cvariable;
+        const auto one_over_rho = SIMD_DIV(packed_one, rho);
+        const auto u = SIMD_MUL(rhou, one_over_rho);
+        const auto v = SIMD_MUL(rhov, one_over_rho);
+        const auto kinetic_energy = SIMD_MUL(packed_half, SIMD_ADD(SIMD_MUL(rhou, u), SIMD_MUL(rhov, v)));
+        const auto p = SIMD_MUL(SIMD_SUB(rhoE, kinetic_energy), packed_gamma_minus_one);
+        const auto a = SIMD_SQRT(SIMD_MUL(SIMD_MUL(packed_gamma, p), one_over_rho));
+        const Packed_Double_ pvariable[4] = { u, v, p, a };
+        std::copy_n(pvariable, 4, state.pvariable);
+
+        const auto rhouv = SIMD_MUL(rhou, v);
+        const auto rhoE_plus_p = SIMD_ADD(rhoE, p);
+        const Packed_Double_ physical_flux[8] = {
+            rhou,                                   rhov,
+            SIMD_ADD(SIMD_MUL(rhou, u), p),         rhouv,
+            rhouv,                                  SIMD_ADD(SIMD_MUL(rhov, v), p),
+            SIMD_MUL(rhoE_plus_p, u),               SIMD_MUL(rhoE_plus_p, v)
+        };
+        std::copy_n(physical_flux, 8, state.physical_flux);
+        return state;
+    };
+
+    for (; i + simd_width <= num_face; i += simd_width) {
+        const auto oc_side_state = load_side_state(oc_side_cvariables);
+        const auto nc_side_state = load_side_state(nc_side_cvariables);
+        const auto nx = SIMD_LOAD(normals[0].data() + i);
+        const auto ny = SIMD_LOAD(normals[1].data() + i);
+
+        // same operation order with Euler_2D::inner_face_maximum_lambda, max(nc,oc) picks oc on tie like std::max(oc,nc)
+        const auto calculate_side_lambda = [&](const Packed_Side_State& state) {
+            const auto normal_velocity = SIMD_ADD(SIMD_MUL(state.pvariable[0], nx), SIMD_MUL(state.pvariable[1], ny));
+            return SIMD_ADD(SIMD_ABS(normal_velocity), state.pvariable[3]);
+        };
+        const auto inner_face_maximum_lambda = SIMD_MAX(calculate_side_lambda(nc_side_state), calculate_side_lambda(oc_side_state));
+
+        // same operation order with 0.5 * ((oc_physical_flux + nc_physical_flux) * normal + lambda * (oc_cvariable - nc_cvariable))
+        for (size_t e = 0; e < 4; ++e) {
+            const auto x_flux_sum = SIMD_ADD(oc_side_state.physical_flux[2 * e], nc_side_state.physical_flux[2 * e]);
+            const auto y_flux_sum = SIMD_ADD(oc_side_state.physical_flux[2 * e + 1], nc_side_state.physical_flux[2 * e + 1]);
+            const auto normal_flux = SIMD_ADD(SIMD_ADD(packed_zero, SIMD_MUL(x_flux_sum, nx)), SIMD_MUL(y_flux_sum, ny));
+            const auto diffusion = SIMD_MUL(SIMD_SUB(oc_side_state.cvariable[e], nc_side_state.cvariable[e]), inner_face_maximum_lambda);
+
+            SIMD_STORE(numerical_fluxes[e].data() + i, SIMD_MUL(SIMD_ADD(normal_flux, diffusion), packed_half));
+        }
+    }
+#endif
+
+    for (; i < num_face; ++i) {
+        const Solution_ oc_side_cvariable = { oc_side_cvariables[0][i], oc_side_cvariables[1][i], oc_side_cvariables[2][i], oc_side_cvariables[3][i] };
+        const Solution_ nc_side_cvariable = { nc_side_cvariables[0][i], nc_side_cvariables[1][i], nc_side_cvariables[2][i], nc_side_cvariables[3][i] };
+        const Space_Vector_ normal = { normals[0][i], normals[1][i] };
+
+        const auto numerical_flux = calculate(oc_side_cvariable, nc_side_cvariable, normal);
+        for (size_t e = 0; e < 4; ++e)
+            numerical_fluxes[e][i] = numerical_flux[e];
+    }
 }
\ No newline at end of file
@@ -37,25 +37,4 @@ void PostAI::post(void) {
 	target_cell_indexes_.clear();
 
 #endif
-}
-
-std::vector<std::string> PostAI::convert_to_solution_gradient_strings(const std::vector<Dynamic_Matrix_>& solution_gradients) {
-	const auto num_solution = solution_gradients.size();
-	const auto [num_equation, space_dimension] = solution_gradients.front().size();
-
-	std::vector<std::string> solution_gradient_strings;
-	solution_gradient_strings.reserve(num_solution);
-
-	std::string solution_gradient_string;
-	for (size_t i = 0; i < num_solution; ++i) {
-
-		const auto& solution_gradient = solution_gradients[i];
-		for (size_t j = 0; j < num_equation; ++j)
-			for (size_t k = 0; k < space_dimension; ++k)
-				solution_gradient_string += ms::double_to_str_sp(solution_gradient.at(j, k)) + "\t";
-
-		solution_gradient_strings.push_back(std::move(solution_gradient_string));
-	}
-
-	return solution_gradient_strings;
 }
\ No newline at end of file
@@ -1,5 +1,12 @@
 
 #include "../INC/Profiler.h"
+#include "../INC/Setting.h"
+
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
 
 void Profiler::record_Consumed_Memory(void){		
 	GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&memory_recorder_, sizeof(memory_recorder_));
@@ -44,4 +51,60 @@ void Profiler::print_Consumed_Memory_And_Time(void) {
 
 	memory_record_.pop_back();
 	time_points_.pop_back();
-}
\ No newline at end of file
+}
+
+void Profiler::count_heap_allocation(void) {
+	num_heap_allocation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t Profiler::num_heap_allocation(void) {
+	return num_heap_allocation_.load(std::memory_order_relaxed);
+}
+
+
+#ifdef COUNT_HEAP_ALLOCATION
+// replaceable global allocation functions, every heap allocation of the program is counted
+void* operator new(std::size_t size) {
+	Profiler::count_heap_allocation();
+
+	if (const auto ptr = std::malloc(size == 0 ? 1 : size))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	Profiler::count_heap_allocation();
+
+	const auto alignment_size = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+	// MSVC has no std::aligned_alloc, since its free can not release over-aligned memory
+	const auto ptr = _aligned_malloc(size == 0 ? 1 : size, alignment_size);
+#else
+	// size of std::aligned_alloc should be multiple of alignment
+	const auto ptr = std::aligned_alloc(alignment_size, ((size == 0 ? 1 : size) + alignment_size - 1) / alignment_size * alignment_size);
+#endif
+	if (ptr)
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#ifdef _WIN32
+	_aligned_free(ptr);
+#else
+	std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+	operator delete(ptr, alignment);
+}
+#endif
\ No newline at end of file
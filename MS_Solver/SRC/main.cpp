@@ -15,6 +15,7 @@ int main(void) {
 	PostAI::set_path(PATH + "AI_Data/");
 
 	auto grid = Grid_Builder_::build<GRID_FILE_TYPE>(GRID_FILE_NAME);
+	Grid_Builder_::renumber<CELL_ORDERING>(grid);
 
 	Post_::intialize();
 	Post_::grid(grid.elements.cell_elements);
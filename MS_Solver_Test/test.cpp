@@ -1,6 +1,89 @@
 #include "pch.h"
+#include "../MS_Solver/INC/Neural_Network.h"
+#include "../MS_Solver/INC/Numerical_Flux_Function.h"
+
+#include <cstring>
+#include <filesystem>
+#include <random>
 
 TEST(TestCaseName, TestName) {
   EXPECT_EQ(1, 1);
   EXPECT_TRUE(true);
-}
\ No newline at end of file
+}
+
+TEST(LLF_Euler_2D, Batched_Calculate_Is_Bitwise_Identical) {
+  using Face_State_Block_ = LLF<Euler_2D>::Face_State_Block_;
+  constexpr auto gamma = 1.4;
+
+  std::mt19937 generator(2021);
+  std::uniform_real_distribution<double> density_distribution(0.1, 2.0);
+  std::uniform_real_distribution<double> velocity_distribution(-2.0, 2.0);
+  std::uniform_real_distribution<double> pressure_distribution(0.1, 2.0);
+  std::uniform_real_distribution<double> angle_distribution(0.0, 6.283185307179586);
+
+  const auto make_cvariable = [&](void) {
+    const auto rho = density_distribution(generator);
+    const auto u = velocity_distribution(generator);
+    const auto v = velocity_distribution(generator);
+    const auto p = pressure_distribution(generator);
+    return Euler_2D::Solution_{ rho, rho * u, rho * v, p / (gamma - 1) + 0.5 * rho * (u * u + v * v) };
+  };
+
+  Face_State_Block_ face_state_block;
+  face_state_block.num_face = Face_State_Block_::capacity_ - 3;  // remainder faces take scalar path
+
+  std::vector<Euler_2D::Solution_> oc_side_cvariables, nc_side_cvariables;
+  std::vector<Euler_2D::Space_Vector_> normals;
+  for (size_t i = 0; i < face_state_block.num_face; ++i) {
+    const auto angle = angle_distribution(generator);
+    oc_side_cvariables.push_back(make_cvariable());
+    nc_side_cvariables.push_back(make_cvariable());
+    normals.push_back({ std::cos(angle), std::sin(angle) });
+
+    for (size_t e = 0; e < 4; ++e) {
+      face_state_block.oc_side_solutions[e][i] = oc_side_cvariables[i][e];
+      face_state_block.nc_side_solutions[e][i] = nc_side_cvariables[i][e];
+    }
+    for (size_t d = 0; d < 2; ++d)
+      face_state_block.normals[d][i] = normals[i][d];
+  }
+
+  LLF<Euler_2D>::calculate(face_state_block);
+
+  for (size_t i = 0; i < face_state_block.num_face; ++i) {
+    const auto numerical_flux = LLF<Euler_2D>::calculate(oc_side_cvariables[i], nc_side_cvariables[i], normals[i]);
+    for (size_t e = 0; e < 4; ++e) {
+      const auto expect = numerical_flux[e];
+      const auto result = face_state_block.numerical_fluxes[e][i];
+      EXPECT_EQ(0, std::memcmp(&expect, &result, sizeof(double))) << "face " << i << ", equation " << e;
+    }
+  }
+}
+
+TEST(Neural_Network, Shipped_AI_Limiter_Weights_Pass_MLP_u1_Value_Through) {
+  constexpr size_t num_feature = 5;
+  constexpr size_t num_batch = 100;  // more than one batch block
+
+  const auto weight_file_path = std::filesystem::path(__FILE__).parent_path() / "../MS_Solver/RSC/AI/AI_Limiter.bin";
+  const Neural_Network neural_network(weight_file_path.string());
+  ASSERT_EQ(num_feature, neural_network.num_input());
+  ASSERT_EQ(1, neural_network.num_output());
+
+  std::mt19937 generator(2021);
+  std::uniform_real_distribution<double> feature_distribution(-1.0, 1.0);
+  std::uniform_real_distribution<double> limiting_value_distribution(0.0, 1.0);
+
+  std::vector<double> features(num_batch * num_feature);
+  for (size_t b = 0; b < num_batch; ++b) {
+    for (size_t f = 0; f < num_feature - 1; ++f)
+      features[b * num_feature + f] = feature_distribution(generator);
+    features[b * num_feature + num_feature - 1] = limiting_value_distribution(generator);  // MLP-u1 limiting value
+  }
+
+  std::vector<double> ai_limiting_values(num_batch);
+  std::array<std::vector<double>, 2> layer_output_buffers;
+  neural_network.infer(features.data(), num_batch, ai_limiting_values.data(), layer_output_buffers);
+
+  for (size_t b = 0; b < num_batch; ++b)
+    EXPECT_DOUBLE_EQ(features[b * num_feature + num_feature - 1], ai_limiting_values[b]) << "batch " << b;
+}